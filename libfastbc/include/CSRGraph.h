@@ -0,0 +1,379 @@
+#ifndef FASTBC_CSR_GRAPH_H
+#define FASTBC_CSR_GRAPH_H
+
+#include <IDegreeGraph.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace fastbc {
+
+	/**
+	 *	@brief Directed weighted graph stored in compressed sparse row format
+	 *
+	 *	@details Forward and backward stars of every vertex are stored as slices of
+	 *			 contiguous adjacent vertex/weight arrays, delimited by an offsets array.
+	 *			 Edges added through addEdge are buffered and compacted into the CSR
+	 *			 storage by initVertices, merging duplicated edges by summing their weight.
+	 *
+	 *	@tparam V Type for vertex index number
+	 *	@tparam W Type for edge weight value
+	 */
+	template<typename V, typename W>
+	class CSRGraph : public IDegreeGraph<V, W>
+	{
+	public:
+		/**
+		 *	@brief Initialize a CSR graph from input stream
+		 *
+		 *	@details Given input stream should feed edges information like:
+		 *			<src_index> <dest_index> <edge_weight>
+		 *
+		 *	@note Input graph is expected to have subsequent vertex indices starting from 0
+		 *
+		 *	@param inputTextGraph Graph edges input stream
+		 */
+		CSRGraph(std::istream& inputTextGraph);
+
+		/**
+		 *	@brief Initialize a CSR graph from parallel edge arrays
+		 *
+		 *	@note Given arrays are moved to the graph and released once compacted
+		 *
+		 *	@param src Source vertex of each edge
+		 *	@param dest Destination vertex of each edge
+		 *	@param weight Weight of each edge
+		 */
+		CSRGraph(std::vector<V>&& src, std::vector<V>&& dest, std::vector<W>&& weight);
+
+		CSRGraph();
+
+		W edge(V src, V dest) const override;
+
+		Star<V, W> forwardStar(V src) const override;
+
+		Star<V, W> backwardStar(V dest) const override;
+
+		const std::vector<V>& vertices() const override;
+
+		V edges() const override;
+
+		void addEdge(V from, V to, W weight) override;
+
+		/**
+		 *	@brief Compact buffered edges into CSR storage and initialize vertices list
+		 *
+		 *	@note Must be called after edges insertion for them to be visible
+		 */
+		void initVertices() override;
+
+		W totalWeight() const override;
+
+		W inWeightedDegree(V v) const override;
+
+		W outWeightedDegree(V v) const override;
+
+	private:
+		V _edges;
+		W _totalWeight;
+		std::vector<V> _vertices;
+		std::vector<W> _inWeightedDegrees;
+		std::vector<W> _outWeightedDegrees;
+
+		std::vector<size_t> _forwardOffsets;
+		std::vector<V> _forwardVertices;
+		std::vector<W> _forwardWeights;
+		std::vector<size_t> _backwardOffsets;
+		std::vector<V> _backwardVertices;
+		std::vector<W> _backwardWeights;
+
+		// Edges added since last initVertices call
+		std::vector<V> _pendingSrc;
+		std::vector<V> _pendingDest;
+		std::vector<W> _pendingWeight;
+
+		static void _buildStars(
+			size_t vertexCount,
+			const std::vector<V>& keys,
+			const std::vector<V>& adjacents,
+			const std::vector<W>& edgeWeights,
+			std::vector<size_t>& offsets,
+			std::vector<V>& vertices,
+			std::vector<W>& weights);
+	};
+
+}
+
+template<typename V, typename W>
+fastbc::CSRGraph<V, W>::CSRGraph()
+	: _edges(0), _totalWeight(0), _forwardOffsets(1, 0), _backwardOffsets(1, 0) {}
+
+template<typename V, typename W>
+fastbc::CSRGraph<V, W>::CSRGraph(std::vector<V>&& src, std::vector<V>&& dest, std::vector<W>&& weight)
+	: CSRGraph()
+{
+	if (src.size() != dest.size() || src.size() != weight.size())
+	{
+		throw std::invalid_argument("Edge arrays must share the same size");
+	}
+
+	_pendingSrc = std::move(src);
+	_pendingDest = std::move(dest);
+	_pendingWeight = std::move(weight);
+
+	initVertices();
+}
+
+template<typename V, typename W>
+fastbc::CSRGraph<V, W>::CSRGraph(std::istream& inputTextGraph)
+	: CSRGraph()
+{
+	// Read input stream buffering each edge
+	while (!inputTextGraph.eof())
+	{
+		V src, dest;
+		W weight;
+		inputTextGraph >> src >> dest >> weight;
+
+		if (weight <= 0)
+		{
+			throw std::invalid_argument("Edge weight must be greater than zero");
+		}
+
+		// Stop when eof has been reached
+		if (!inputTextGraph)
+		{
+			break;
+		}
+
+		addEdge(src, dest, weight);
+	}
+
+	initVertices();
+}
+
+template<typename V, typename W>
+W fastbc::CSRGraph<V, W>::edge(V src, V dest) const
+{
+	const auto fs = forwardStar(src);
+
+	if (auto w = fs.find(dest); w != fs.end())
+	{
+		return w->second;
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+template<typename V, typename W>
+fastbc::Star<V, W> fastbc::CSRGraph<V, W>::forwardStar(V src) const
+{
+	size_t begin = _forwardOffsets[src];
+	return Star<V, W>(_forwardVertices.data() + begin, _forwardWeights.data() + begin,
+		_forwardOffsets[src + 1] - begin);
+}
+
+template<typename V, typename W>
+fastbc::Star<V, W> fastbc::CSRGraph<V, W>::backwardStar(V dest) const
+{
+	size_t begin = _backwardOffsets[dest];
+	return Star<V, W>(_backwardVertices.data() + begin, _backwardWeights.data() + begin,
+		_backwardOffsets[dest + 1] - begin);
+}
+
+template<typename V, typename W>
+const std::vector<V>& fastbc::CSRGraph<V, W>::vertices() const
+{
+	return _vertices;
+}
+
+template<typename V, typename W>
+V fastbc::CSRGraph<V, W>::edges() const
+{
+	return _edges;
+}
+
+template<typename V, typename W>
+void fastbc::CSRGraph<V, W>::addEdge(V from, V to, W weight)
+{
+	_pendingSrc.push_back(from);
+	_pendingDest.push_back(to);
+	_pendingWeight.push_back(weight);
+}
+
+template<typename V, typename W>
+void fastbc::CSRGraph<V, W>::initVertices()
+{
+	size_t vertexCount = _vertices.size();
+
+	// Move already compacted edges back to the buffer to merge them with new ones
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		for (size_t e = _forwardOffsets[v]; e < _forwardOffsets[v + 1]; ++e)
+		{
+			_pendingSrc.push_back(v);
+			_pendingDest.push_back(_forwardVertices[e]);
+			_pendingWeight.push_back(_forwardWeights[e]);
+		}
+	}
+
+	size_t maxVertex = 0;
+	#pragma omp parallel for reduction(max:maxVertex)
+	for (size_t e = 0; e < _pendingSrc.size(); ++e)
+	{
+		maxVertex = std::max(maxVertex, (size_t)std::max(_pendingSrc[e], _pendingDest[e]) + 1);
+	}
+	vertexCount = std::max(vertexCount, maxVertex);
+
+	_buildStars(vertexCount, _pendingSrc, _pendingDest, _pendingWeight,
+		_forwardOffsets, _forwardVertices, _forwardWeights);
+	_buildStars(vertexCount, _pendingDest, _pendingSrc, _pendingWeight,
+		_backwardOffsets, _backwardVertices, _backwardWeights);
+	_edges = _forwardVertices.size();
+
+	// Weighted degrees are summed over compacted stars to be independent from edges order
+	_inWeightedDegrees.assign(vertexCount, 0);
+	_outWeightedDegrees.assign(vertexCount, 0);
+	#pragma omp parallel for schedule(dynamic, 1024)
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		for (size_t e = _forwardOffsets[v]; e < _forwardOffsets[v + 1]; ++e)
+		{
+			_outWeightedDegrees[v] += _forwardWeights[e];
+		}
+
+		for (size_t e = _backwardOffsets[v]; e < _backwardOffsets[v + 1]; ++e)
+		{
+			_inWeightedDegrees[v] += _backwardWeights[e];
+		}
+	}
+
+	_totalWeight = 0;
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		_totalWeight += _outWeightedDegrees[v];
+	}
+
+	_pendingSrc = std::vector<V>();
+	_pendingDest = std::vector<V>();
+	_pendingWeight = std::vector<W>();
+
+	// Initialize vertices list
+	_vertices.resize(vertexCount);
+	#pragma omp simd
+	for (size_t v = 0; v < _vertices.size(); v++)
+	{
+		_vertices[v] = v;
+	}
+}
+
+template<typename V, typename W>
+W fastbc::CSRGraph<V, W>::totalWeight() const
+{
+	return _totalWeight;
+}
+
+template<typename V, typename W>
+W fastbc::CSRGraph<V, W>::inWeightedDegree(V v) const
+{
+	return _inWeightedDegrees[v];
+}
+
+template<typename V, typename W>
+W fastbc::CSRGraph<V, W>::outWeightedDegree(V v) const
+{
+	return _outWeightedDegrees[v];
+}
+
+template<typename V, typename W>
+void fastbc::CSRGraph<V, W>::_buildStars(
+	size_t vertexCount,
+	const std::vector<V>& keys,
+	const std::vector<V>& adjacents,
+	const std::vector<W>& edgeWeights,
+	std::vector<size_t>& offsets,
+	std::vector<V>& vertices,
+	std::vector<W>& weights)
+{
+	// Count edges for each key vertex
+	offsets.assign(vertexCount + 1, 0);
+	#pragma omp parallel for
+	for (size_t e = 0; e < keys.size(); ++e)
+	{
+		#pragma omp atomic
+		offsets[keys[e] + 1]++;
+	}
+
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		offsets[v + 1] += offsets[v];
+	}
+
+	// Scatter edges to their key vertex slice
+	std::vector<std::pair<V, W>> star(keys.size());
+	std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+	#pragma omp parallel for
+	for (size_t e = 0; e < keys.size(); ++e)
+	{
+		size_t pos;
+		#pragma omp atomic capture
+		pos = next[keys[e]]++;
+
+		star[pos] = std::make_pair(adjacents[e], edgeWeights[e]);
+	}
+	next = std::vector<size_t>();
+
+	// Sort each slice, also by weight so that duplicates are merged in a deterministic order,
+	// and count distinct adjacent vertices
+	std::vector<size_t> merged(vertexCount + 1, 0);
+	#pragma omp parallel for schedule(dynamic, 1024)
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		std::sort(star.begin() + offsets[v], star.begin() + offsets[v + 1]);
+
+		for (size_t e = offsets[v]; e < offsets[v + 1]; ++e)
+		{
+			if (e == offsets[v] || star[e].first != star[e - 1].first)
+			{
+				merged[v + 1]++;
+			}
+		}
+	}
+
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		merged[v + 1] += merged[v];
+	}
+
+	// Copy slices to contiguous storage, merging duplicated edges
+	vertices.resize(merged[vertexCount]);
+	weights.resize(merged[vertexCount]);
+	#pragma omp parallel for schedule(dynamic, 1024)
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		size_t stored = merged[v];
+		for (size_t e = offsets[v]; e < offsets[v + 1]; ++e)
+		{
+			if (e != offsets[v] && star[e].first == star[e - 1].first)
+			{
+				weights[stored - 1] += star[e].second;
+			}
+			else
+			{
+				vertices[stored] = star[e].first;
+				weights[stored] = star[e].second;
+				++stored;
+			}
+		}
+	}
+
+	offsets = std::move(merged);
+}
+
+#endif
@@ -3,9 +3,11 @@
 
 #include <IDegreeGraph.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
-#include <map>
-#include <set>
+#include <stdexcept>
+#include <tuple>
 #include <vector>
 
 namespace fastbc {
@@ -30,16 +32,27 @@ namespace fastbc {
 
         W edge(V src, V dest) const override;
 
-        const std::map<V, W>& forwardStar(V src) const override;
+        Star<V, W> forwardStar(V src) const override;
 
-		const std::map<V, W>& backwardStar(V dest) const override;
+		Star<V, W> backwardStar(V dest) const override;
 
 		const std::vector<V>& vertices() const override;
 
         V edges() const override;
 
+		/**
+		 *	@brief Add an edge, summing its weight to the existing one if already present
+		 *
+		 *	@details The edge is inserted in place in the contiguous stars storage, in time
+		 *			 linear in the number of vertices and edges, and is visible at once.
+		 */
         void addEdge(V from, V to, W weight) override;
 
+		/**
+		 *	@brief Initialize vertices list
+		 * 
+		 *	@note Must be called after edges insertion for new vertices to be listed
+		 */
         void initVertices() override;
 
         W totalWeight() const override;
@@ -54,21 +67,50 @@ namespace fastbc {
 		std::vector<V> _vertices;
 		std::vector<W> _inWeightedDegrees;
 		std::vector<W> _outWeightedDegrees;
-        std::vector<std::map<V, W>> _srcDestWeight;
-		std::vector<std::map<V, W>> _destSrcWeight;
+
+		// Stars stored contiguously, each one sorted by adjacent vertex
+		std::vector<size_t> _forwardOffsets;
+		std::vector<V> _forwardVertices;
+		std::vector<W> _forwardWeights;
+		std::vector<size_t> _backwardOffsets;
+		std::vector<V> _backwardVertices;
+		std::vector<W> _backwardWeights;
+
+		// Add vertices up to given one, without edges
+		void _resize(V v);
+
+		// Insert edge in star of owner vertex, return false if the edge was already present
+		static bool _insertEdge(
+			std::vector<size_t>& offsets,
+			std::vector<V>& vertices,
+			std::vector<W>& weights,
+			V owner,
+			V adjacent,
+			W weight);
+
+		// Fill stars from edges sorted by owner and adjacent vertex, without duplicates
+		template<typename Owner, typename Adjacent>
+		static void _fillStars(
+			const std::vector<std::tuple<V, V, W>>& edges,
+			Owner owner,
+			Adjacent adjacent,
+			std::vector<size_t>& offsets,
+			std::vector<V>& vertices,
+			std::vector<W>& weights);
     };   
 
 }
 
 template<typename V, typename W>
 fastbc::DirectedWeightedGraph<V, W>::DirectedWeightedGraph()
-	: _edges(0) {}
+	: _edges(0), _totalWeight(0) {}
 
 template<typename V, typename W>
 fastbc::DirectedWeightedGraph<V, W>::DirectedWeightedGraph(std::istream& inputTextGraph)
-    : _edges(0)
+    : _edges(0), _totalWeight(0)
 {
-	// Read input stream and initialize forward and backward star for each vertex
+	// Read input stream edges, stars are filled at once instead of an insertion per edge
+	std::vector<std::tuple<V, V, W>> edges;
     while (!inputTextGraph.eof())
     {
         V src, dest;
@@ -86,11 +128,42 @@ fastbc::DirectedWeightedGraph<V, W>::DirectedWeightedGraph(std::istream& inputTe
 			break;
 		}
 
-        addEdge(src, dest, weight);
+		edges.emplace_back(src, dest, weight);
+		_resize(std::max(src, dest));
+		_totalWeight += weight;
+		_inWeightedDegrees[dest] += weight;
+		_outWeightedDegrees[src] += weight;
     }
 
-	// Ensure both forward and backward star containers share same size
-	_destSrcWeight.resize(_srcDestWeight.size());
+	// Merge duplicated edges summing their weight
+	std::sort(edges.begin(), edges.end(), [](const auto& a, const auto& b)
+	{
+		return std::tie(std::get<0>(a), std::get<1>(a)) < std::tie(std::get<0>(b), std::get<1>(b));
+	});
+	size_t last = 0;
+	for (size_t e = 1; e < edges.size(); ++e)
+	{
+		if (std::get<0>(edges[e]) == std::get<0>(edges[last]) && std::get<1>(edges[e]) == std::get<1>(edges[last]))
+		{
+			std::get<2>(edges[last]) += std::get<2>(edges[e]);
+		}
+		else
+		{
+			edges[++last] = edges[e];
+		}
+	}
+	edges.resize(edges.empty() ? 0 : last + 1);
+	_edges = edges.size();
+
+	auto src = [](const std::tuple<V, V, W>& e) { return std::get<0>(e); };
+	auto dest = [](const std::tuple<V, V, W>& e) { return std::get<1>(e); };
+	_fillStars(edges, src, dest, _forwardOffsets, _forwardVertices, _forwardWeights);
+
+	std::sort(edges.begin(), edges.end(), [](const auto& a, const auto& b)
+	{
+		return std::tie(std::get<1>(a), std::get<0>(a)) < std::tie(std::get<1>(b), std::get<0>(b));
+	});
+	_fillStars(edges, dest, src, _backwardOffsets, _backwardVertices, _backwardWeights);
 
 	initVertices();
 }
@@ -98,26 +171,36 @@ fastbc::DirectedWeightedGraph<V, W>::DirectedWeightedGraph(std::istream& inputTe
 template<typename V, typename W>
 W fastbc::DirectedWeightedGraph<V, W>::edge(V src, V dest) const
 {
-    if(auto it = _srcDestWeight[src].find(dest); it != _srcDestWeight[src].end())
-    {
-        return it->second;
-    }
-    else
-    {
-        return 0;
-    }
+	if ((size_t)src + 1 >= _forwardOffsets.size())
+	{
+		return 0;
+	}
+
+	const auto fs = forwardStar(src);
+	if (auto it = fs.find(dest); it != fs.end())
+	{
+		return it->second;
+	}
+	else
+	{
+		return 0;
+	}
 }
 
 template<typename V, typename W>
-const std::map<V, W>& fastbc::DirectedWeightedGraph<V, W>::forwardStar(V src) const
+fastbc::Star<V, W> fastbc::DirectedWeightedGraph<V, W>::forwardStar(V src) const
 {
-    return _srcDestWeight[src];
+	size_t begin = _forwardOffsets[src];
+	return Star<V, W>(_forwardVertices.data() + begin, _forwardWeights.data() + begin, 
+		_forwardOffsets[src + 1] - begin);
 }
 
 template<typename V, typename W>
-const std::map<V, W>& fastbc::DirectedWeightedGraph<V, W>::backwardStar(V dest) const
+fastbc::Star<V, W> fastbc::DirectedWeightedGraph<V, W>::backwardStar(V dest) const
 {
-	return _destSrcWeight[dest];
+	size_t begin = _backwardOffsets[dest];
+	return Star<V, W>(_backwardVertices.data() + begin, _backwardWeights.data() + begin, 
+		_backwardOffsets[dest + 1] - begin);
 }
 
 template<typename V, typename W>
@@ -135,34 +218,13 @@ V fastbc::DirectedWeightedGraph<V, W>::edges() const
 template<typename V, typename W>
 void fastbc::DirectedWeightedGraph<V, W>::addEdge(V from, V to, W weight) 
 {
-	if(_srcDestWeight.size() <= from)
-    {
-        _srcDestWeight.resize(from + 1);
-    }
+	_resize(std::max(from, to));
 
-	if (_destSrcWeight.size() <= to)
+	if (_insertEdge(_forwardOffsets, _forwardVertices, _forwardWeights, from, to, weight))
 	{
-		_destSrcWeight.resize(to + 1);
-	}
-
-	int s = (to > from) ? to : from;
-	if (_inWeightedDegrees.size() <= s)
-		_inWeightedDegrees.resize(s + 1, 0);
-	if (_outWeightedDegrees.size() <= s)
-		_outWeightedDegrees.resize(s + 1, 0);
-
-	if(_srcDestWeight[from].count(to) > 0) {
-		_srcDestWeight[from][to] += weight;
-	} else {
-		_srcDestWeight[from][to] = weight;
-    	_edges++;
-	}
-
-	if(_destSrcWeight[to].count(from) > 0) {
-		_destSrcWeight[to][from] += weight;
-	} else {
-		_destSrcWeight[to][from] = weight;
+		_edges++;
 	}
+	_insertEdge(_backwardOffsets, _backwardVertices, _backwardWeights, to, from, weight);
 
     _totalWeight += weight;
 	_inWeightedDegrees[to] += weight;
@@ -173,7 +235,7 @@ template<typename V, typename W>
 void fastbc::DirectedWeightedGraph<V, W>::initVertices() 
 {
 	// Initialize vertices list
-	_vertices.resize(_srcDestWeight.size());
+	_vertices.resize(_inWeightedDegrees.size());
 	#pragma omp simd
 	for (size_t v = 0; v < _vertices.size(); v++)
 	{
@@ -181,6 +243,77 @@ void fastbc::DirectedWeightedGraph<V, W>::initVertices()
 	}
 }
 
+template<typename V, typename W>
+void fastbc::DirectedWeightedGraph<V, W>::_resize(V v)
+{
+	size_t count = (size_t)v + 1;
+	if (_inWeightedDegrees.size() >= count)
+	{
+		return;
+	}
+
+	_inWeightedDegrees.resize(count, 0);
+	_outWeightedDegrees.resize(count, 0);
+	_forwardOffsets.resize(count + 1, _forwardOffsets.empty() ? 0 : _forwardOffsets.back());
+	_backwardOffsets.resize(count + 1, _backwardOffsets.empty() ? 0 : _backwardOffsets.back());
+}
+
+template<typename V, typename W>
+bool fastbc::DirectedWeightedGraph<V, W>::_insertEdge(
+	std::vector<size_t>& offsets,
+	std::vector<V>& vertices,
+	std::vector<W>& weights,
+	V owner,
+	V adjacent,
+	W weight)
+{
+	auto begin = vertices.begin() + offsets[owner];
+	auto end = vertices.begin() + offsets[owner + 1];
+	auto it = std::lower_bound(begin, end, adjacent);
+	size_t i = it - vertices.begin();
+
+	if (it != end && *it == adjacent)
+	{
+		weights[i] += weight;
+		return false;
+	}
+
+	vertices.insert(it, adjacent);
+	weights.insert(weights.begin() + i, weight);
+	for (size_t v = (size_t)owner + 1; v < offsets.size(); ++v)
+	{
+		offsets[v]++;
+	}
+
+	return true;
+}
+
+template<typename V, typename W>
+template<typename Owner, typename Adjacent>
+void fastbc::DirectedWeightedGraph<V, W>::_fillStars(
+	const std::vector<std::tuple<V, V, W>>& edges,
+	Owner owner,
+	Adjacent adjacent,
+	std::vector<size_t>& offsets,
+	std::vector<V>& vertices,
+	std::vector<W>& weights)
+{
+	std::fill(offsets.begin(), offsets.end(), 0);
+	vertices.resize(edges.size());
+	weights.resize(edges.size());
+	for (size_t e = 0; e < edges.size(); ++e)
+	{
+		offsets[owner(edges[e]) + 1]++;
+		vertices[e] = adjacent(edges[e]);
+		weights[e] = std::get<2>(edges[e]);
+	}
+
+	for (size_t v = 1; v < offsets.size(); ++v)
+	{
+		offsets[v] += offsets[v - 1];
+	}
+}
+
 template<typename V, typename W>
 W fastbc::DirectedWeightedGraph<V, W>::totalWeight() const
 {
@@ -0,0 +1,198 @@
+#ifndef FASTBC_EDGE_LIST_LOADER_H
+#define FASTBC_EDGE_LIST_LOADER_H
+
+#include <CSRGraph.h>
+#include <MappedFile.h>
+
+#include <algorithm>
+#include <charconv>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <omp.h>
+
+namespace fastbc {
+
+	/**
+	 *	@brief Parallel loader of text edge list files
+	 *
+	 *	@details The file is memory mapped and split in one chunk per thread on line
+	 *			 boundaries. Each chunk is parsed concurrently and the resulting edges
+	 *			 are compacted into a CSR graph with parallel counting sort.
+	 *			 Each line of the file is expected to describe an edge like:
+	 *			<src_index> <dest_index> <edge_weight>
+	 *
+	 *	@tparam V Type for vertex index number
+	 *	@tparam W Type for edge weight value
+	 */
+	template<typename V, typename W>
+	class EdgeListLoader
+	{
+	public:
+
+		/**
+		 *	@brief Load edge list file at given path
+		 *
+		 *	@param path Edge list file path
+		 *	@return std::shared_ptr<CSRGraph<V, W>> Loaded graph
+		 */
+		std::shared_ptr<CSRGraph<V, W>> load(const std::string& path) const;
+
+	private:
+
+		struct edges_t
+		{
+			std::vector<V> src;
+			std::vector<V> dest;
+			std::vector<W> weight;
+		};
+
+		static void _parseChunk(const char* begin, const char* end, edges_t& edges);
+
+		template<typename T>
+		static const char* _parseValue(const char* it, const char* end, T& value);
+	};
+
+}
+
+template<typename V, typename W>
+std::shared_ptr<fastbc::CSRGraph<V, W>> fastbc::EdgeListLoader<V, W>::load(const std::string& path) const
+{
+	MappedFile file(path, true);
+	const char* data = file.data();
+	const char* dataEnd = data + file.size();
+
+	std::vector<edges_t> chunkEdges(omp_get_max_threads());
+	std::vector<std::exception_ptr> chunkError(chunkEdges.size());
+
+	// Parse each chunk of the file in parallel
+	#pragma omp parallel num_threads(chunkEdges.size())
+	{
+		size_t chunk = omp_get_thread_num();
+		size_t chunks = omp_get_num_threads();
+
+		// Move chunk boundaries right after the end of the line they fall in
+		auto boundary = [&](size_t c) {
+			if (c == 0) { return data; }
+			if (c >= chunks) { return dataEnd; }
+
+			const char* it = data + file.size() / chunks * c;
+			while (it > data && it < dataEnd && *(it - 1) != '\n') { ++it; }
+			return it;
+		};
+
+		try
+		{
+			_parseChunk(boundary(chunk), boundary(chunk + 1), chunkEdges[chunk]);
+		}
+		catch (...)
+		{
+			chunkError[chunk] = std::current_exception();
+		}
+	}
+
+	for (const auto& error : chunkError)
+	{
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+	}
+
+	// Concatenate chunks edges in file order
+	std::vector<size_t> chunkOffset(chunkEdges.size() + 1, 0);
+	for (size_t c = 0; c < chunkEdges.size(); ++c)
+	{
+		chunkOffset[c + 1] = chunkOffset[c] + chunkEdges[c].src.size();
+	}
+
+	edges_t edges;
+	edges.src.resize(chunkOffset.back());
+	edges.dest.resize(chunkOffset.back());
+	edges.weight.resize(chunkOffset.back());
+
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (size_t c = 0; c < chunkEdges.size(); ++c)
+	{
+		std::copy(chunkEdges[c].src.begin(), chunkEdges[c].src.end(), edges.src.begin() + chunkOffset[c]);
+		std::copy(chunkEdges[c].dest.begin(), chunkEdges[c].dest.end(), edges.dest.begin() + chunkOffset[c]);
+		std::copy(chunkEdges[c].weight.begin(), chunkEdges[c].weight.end(), edges.weight.begin() + chunkOffset[c]);
+		chunkEdges[c] = edges_t();
+	}
+
+	return std::make_shared<CSRGraph<V, W>>(
+		std::move(edges.src), std::move(edges.dest), std::move(edges.weight));
+}
+
+template<typename V, typename W>
+void fastbc::EdgeListLoader<V, W>::_parseChunk(const char* begin, const char* end, edges_t& edges)
+{
+	// Rough estimate of edges count to limit reallocations
+	size_t expected = (end - begin) / 8;
+	edges.src.reserve(expected);
+	edges.dest.reserve(expected);
+	edges.weight.reserve(expected);
+
+	const char* it = begin;
+	while (true)
+	{
+		V src, dest;
+		W weight;
+
+		it = _parseValue(it, end, src);
+		if (it == nullptr)
+		{
+			break;
+		}
+
+		it = _parseValue(it, end, dest);
+		if (it != nullptr)
+		{
+			it = _parseValue(it, end, weight);
+		}
+
+		if (it == nullptr)
+		{
+			throw std::invalid_argument("Edge list ends with an incomplete edge");
+		}
+
+		if (weight <= 0)
+		{
+			throw std::invalid_argument("Edge weight must be greater than zero");
+		}
+
+		edges.src.push_back(src);
+		edges.dest.push_back(dest);
+		edges.weight.push_back(weight);
+	}
+}
+
+template<typename V, typename W>
+template<typename T>
+const char* fastbc::EdgeListLoader<V, W>::_parseValue(const char* it, const char* end, T& value)
+{
+	// Skip separators, returning null when no more values are available
+	while (it < end && (*it == ' ' || *it == '\t' || *it == '\r' || *it == '\n'))
+	{
+		++it;
+	}
+
+	if (it == end)
+	{
+		return nullptr;
+	}
+
+	auto [next, ec] = std::from_chars(it, end, value);
+	if (ec != std::errc())
+	{
+		throw std::invalid_argument("Invalid value in edge list: \"" +
+			std::string(it, std::find(it, end, '\n')) + "\"");
+	}
+
+	return next;
+}
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef FASTBC_EDGEWEIGHTS_H
+#define FASTBC_EDGEWEIGHTS_H
+
+#include "IGraph.h"
+#include "queue/BucketQueue.h"
+
+#include <cmath>
+#include <limits>
+#include <spdlog/spdlog.h>
+#include <type_traits>
+
+namespace fastbc {
+
+	/**
+	 *	@brief Summary of a graph edge weights, used to select shortest paths algorithms
+	 *
+	 *	@tparam V Type for vertex index number
+	 *	@tparam W Type for edge weight value
+	 */
+	template<typename V, typename W>
+	class EdgeWeights
+	{
+	public:
+		/**
+		 *	@brief Scan edge weights of given graph
+		 *
+		 *	@details Forward stars of all graph vertices are scanned in parallel
+		 *
+		 *	@param graph Graph to scan
+		 */
+		EdgeWeights(const IGraph<V, W>& graph);
+
+		/**
+		 *	@brief Check if all edges have the same weight, or there are no edges
+		 */
+		bool uniform() const;
+
+		/**
+		 *	@brief Check if all edge weights have integer values
+		 */
+		bool integral() const;
+
+		/**
+		 *	@brief Get minimum edge weight, 1 if there are no edges
+		 */
+		W min() const;
+
+		/**
+		 *	@brief Get maximum edge weight, 1 if there are no edges
+		 */
+		W max() const;
+
+		/**
+		 *	@brief Check if edge weights are small non negative integers
+		 *
+		 *	@details Such weights bound distances spread in a Dijkstra's visit queue to
+		 *			 the maximum edge weight, enabling a bucket queue (see queue::BucketQueue).
+		 */
+		bool bucketQueue() const;
+
+	private:
+		W _min;
+		W _max;
+		bool _integral;
+	};
+
+	/**
+	 *	@brief Check if shortest paths on a graph should use a bucket queue instead of Queue
+	 *
+	 *	@details Logs the choice when a bucket queue is selected. Never selected when Queue
+	 *			 already is a bucket queue.
+	 *
+	 *	@tparam Queue Priority queue policy used otherwise
+	 *	@param weights Edge weights of the graph
+	 */
+	template<typename Queue = void, typename V, typename W>
+	bool useBucketQueue(const EdgeWeights<V, W>& weights);
+
+}
+
+template<typename V, typename W>
+fastbc::EdgeWeights<V, W>::EdgeWeights(const IGraph<V, W>& graph)
+{
+	const auto& vertices = graph.vertices();
+
+	W minWeight = std::numeric_limits<W>::max();
+	W maxWeight = std::numeric_limits<W>::lowest();
+	bool integral = true;
+
+	#pragma omp parallel for schedule(dynamic, 1024) reduction(min:minWeight) reduction(max:maxWeight) reduction(&&:integral)
+	for (size_t vIndex = 0; vIndex < vertices.size(); ++vIndex)
+	{
+		const auto fs = graph.forwardStar(vertices[vIndex]);
+		const W* fsWeights = fs.weights();
+		for (size_t i = 0; i < fs.size(); ++i)
+		{
+			minWeight = fsWeights[i] < minWeight ? fsWeights[i] : minWeight;
+			maxWeight = fsWeights[i] > maxWeight ? fsWeights[i] : maxWeight;
+
+			if constexpr (!std::is_integral<W>::value)
+			{
+				integral = integral && std::floor(fsWeights[i]) == fsWeights[i];
+			}
+		}
+	}
+
+	if (minWeight > maxWeight)
+	{
+		minWeight = maxWeight = 1;
+	}
+
+	_min = minWeight;
+	_max = maxWeight;
+	_integral = integral;
+}
+
+template<typename V, typename W>
+bool fastbc::EdgeWeights<V, W>::uniform() const
+{
+	return _min == _max;
+}
+
+template<typename V, typename W>
+bool fastbc::EdgeWeights<V, W>::integral() const
+{
+	return _integral;
+}
+
+template<typename V, typename W>
+W fastbc::EdgeWeights<V, W>::min() const
+{
+	return _min;
+}
+
+template<typename V, typename W>
+W fastbc::EdgeWeights<V, W>::max() const
+{
+	return _max;
+}
+
+template<typename V, typename W>
+bool fastbc::EdgeWeights<V, W>::bucketQueue() const
+{
+	return _integral && _min >= 0 && _max <= (W)queue::BucketQueue<V, W>::maxSpread;
+}
+
+template<typename Queue, typename V, typename W>
+bool fastbc::useBucketQueue(const EdgeWeights<V, W>& weights)
+{
+	if constexpr (std::is_same<Queue, queue::BucketQueue<V, W>>::value)
+	{
+		return false;
+	}
+	else
+	{
+		if (!weights.bucketQueue())
+		{
+			return false;
+		}
+
+		SPDLOG_INFO("Integer edge weights, computing shortest paths with a bucket queue");
+
+		return true;
+	}
+}
+
+#endif
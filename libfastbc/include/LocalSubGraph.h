@@ -0,0 +1,311 @@
+#ifndef FASTBC_LOCALSUBGRAPH_H
+#define FASTBC_LOCALSUBGRAPH_H
+
+#include "IGraph.h"
+#include "ISubGraph.h"
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+#include <vector>
+
+namespace fastbc {
+
+	/**
+	 *	@brief Sub-graph storing its own compact copy of the cluster edges
+	 *
+	 *	@details Sub-graph vertices are renumbered to local indices 0..k-1, following
+	 *			 ascending global index order, and the edges inside the sub-graph are
+	 *			 stored in local CSR arrays. Stars are available both with local
+	 *			 adjacent indices, so that algorithms can use plain vectors indexed by
+	 *			 local vertex, and with global adjacent indices, through IGraph interface.
+	 *
+	 *	@tparam V Type for vertex index number
+	 *	@tparam W Type for edge weight value
+	 */
+	template<typename V, typename W>
+	class LocalSubGraph : public ISubGraph<V, W>
+	{
+	public:
+		/**
+		 *	@brief Initialize a sub-graph with given vertices
+		 *
+		 *	@details Initialization copies the edges between given vertices in O(m*log(n))
+		 *			 time where n is number of vertices and m number of edges
+		 *
+		 *	@param subGraphVertices Vertices of sub-graph to consider
+		 *	@param referenceGraph Full graph where the sub-graph is computed
+		 */
+		LocalSubGraph(
+			const std::vector<V>& subGraphVertices,
+			std::shared_ptr<const IGraph<V, W>> referenceGraph);
+
+		W edge(V src, V dest) const override;
+
+		Star<V, W> forwardStar(V src) const override;
+
+		Star<V, W> backwardStar(V dest) const override;
+
+		const std::vector<V>& vertices() const override;
+
+		V edges() const override;
+
+		const std::set<V>& borders() const override;
+
+		bool isBorder(V vertex) const override;
+
+		std::shared_ptr<const IGraph<V, W>> referenceGraph() const override;
+
+		/**
+		 *	@brief Check if given global vertex belongs to this sub-graph
+		 */
+		bool contains(V vertex) const;
+
+		/**
+		 *	@brief Get local index of given global vertex
+		 *
+		 *	@note Given vertex must belong to this sub-graph
+		 */
+		V localIndex(V vertex) const;
+
+		/**
+		 *	@brief Get global index of given local vertex
+		 */
+		V globalIndex(V local) const;
+
+		/**
+		 *	@brief Get forward star of given local vertex with local adjacent indices
+		 */
+		Star<V, W> localForwardStar(V local) const;
+
+		/**
+		 *	@brief Get backward star of given local vertex with local adjacent indices
+		 */
+		Star<V, W> localBackwardStar(V local) const;
+
+		/**
+		 *	@brief Get local indices of border vertices, in the same order of borders()
+		 */
+		const std::vector<V>& localBorders() const;
+
+	private:
+		/*
+		 *	@brief Sub-graph stars stored with both local and global adjacent indices
+		 */
+		struct local_stars_t
+		{
+			std::vector<size_t> offsets = std::vector<size_t>(1, 0);
+			std::vector<V> localVertices;
+			std::vector<V> globalVertices;
+			std::vector<W> weights;
+		};
+
+		const std::shared_ptr<const IGraph<V, W>> _referenceGraph;
+		const std::vector<V> _vertices;
+		std::vector<V> _globalIndex;
+		bool _contiguous;
+		V _edges;
+		local_stars_t _forward;
+		local_stars_t _backward;
+		std::set<V> _borderVertices;
+		std::vector<V> _localBorders;
+
+		bool _append(const Star<V, W>& star, local_stars_t& stars) const;
+	};
+
+}
+
+template<typename V, typename W>
+fastbc::LocalSubGraph<V, W>::LocalSubGraph(
+	const std::vector<V>& subGraphVertices,
+	std::shared_ptr<const IGraph<V, W>> referenceGraph)
+	: _referenceGraph(referenceGraph),
+	_vertices(subGraphVertices),
+	_globalIndex(subGraphVertices),
+	_edges(0)
+{
+	// Local indices follow global indices order
+	std::sort(_globalIndex.begin(), _globalIndex.end());
+	_contiguous = !_globalIndex.empty() &&
+		(size_t)(_globalIndex.back() - _globalIndex.front()) + 1 == _globalIndex.size();
+
+	for (size_t local = 0; local < _globalIndex.size(); ++local)
+	{
+		V v = _globalIndex[local];
+
+		// Copy stars from reference graph skipping each edge crossing sub-graph border
+		bool isBorder = _append(_referenceGraph->forwardStar(v), _forward);
+		isBorder = _append(_referenceGraph->backwardStar(v), _backward) || isBorder;
+
+		if (isBorder)
+		{
+			_borderVertices.insert(v);
+			_localBorders.push_back(local);
+
+			// If a vertex runs out of edges, the sub-graph is not consistent
+			if (_forward.offsets[local] == _forward.offsets[local + 1] &&
+				_backward.offsets[local] == _backward.offsets[local + 1] &&
+				_globalIndex.size() != 1)
+			{
+				SPDLOG_TRACE("Vertex {} is unconnected in its cluster", v);
+
+#ifdef FASTBC_SUBGRAPH_CONNECTED_ONLY
+				SPDLOG_CRITICAL("Vertex {} is unconnected in its cluster", v);
+				throw std::invalid_argument("Given subgraph has unconnected vertices");
+#endif
+			}
+		}
+	}
+
+	_edges = _forward.localVertices.size();
+}
+
+template<typename V, typename W>
+W fastbc::LocalSubGraph<V, W>::edge(V src, V dest) const
+{
+	const auto fs = forwardStar(src);
+
+	if (auto w = fs.find(dest); w != fs.end())
+	{
+		return w->second;
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+template<typename V, typename W>
+fastbc::Star<V, W> fastbc::LocalSubGraph<V, W>::forwardStar(V src) const
+{
+	if (!contains(src))
+	{
+		return _referenceGraph->forwardStar(src);
+	}
+
+	size_t begin = _forward.offsets[localIndex(src)];
+	return Star<V, W>(_forward.globalVertices.data() + begin, _forward.weights.data() + begin,
+		_forward.offsets[localIndex(src) + 1] - begin);
+}
+
+template<typename V, typename W>
+fastbc::Star<V, W> fastbc::LocalSubGraph<V, W>::backwardStar(V dest) const
+{
+	if (!contains(dest))
+	{
+		return _referenceGraph->backwardStar(dest);
+	}
+
+	size_t begin = _backward.offsets[localIndex(dest)];
+	return Star<V, W>(_backward.globalVertices.data() + begin, _backward.weights.data() + begin,
+		_backward.offsets[localIndex(dest) + 1] - begin);
+}
+
+template<typename V, typename W>
+const std::vector<V>& fastbc::LocalSubGraph<V, W>::vertices() const
+{
+	return _vertices;
+}
+
+template<typename V, typename W>
+V fastbc::LocalSubGraph<V, W>::edges() const
+{
+	return _edges;
+}
+
+template<typename V, typename W>
+const std::set<V>& fastbc::LocalSubGraph<V, W>::borders() const
+{
+	return _borderVertices;
+}
+
+template<typename V, typename W>
+bool fastbc::LocalSubGraph<V, W>::isBorder(V vertex) const
+{
+	return _borderVertices.find(vertex) != _borderVertices.end();
+}
+
+template<typename V, typename W>
+std::shared_ptr<const fastbc::IGraph<V, W>> fastbc::LocalSubGraph<V, W>::referenceGraph() const
+{
+	return _referenceGraph;
+}
+
+template<typename V, typename W>
+bool fastbc::LocalSubGraph<V, W>::contains(V vertex) const
+{
+	if (_contiguous)
+	{
+		return _globalIndex.front() <= vertex && vertex <= _globalIndex.back();
+	}
+
+	return std::binary_search(_globalIndex.begin(), _globalIndex.end(), vertex);
+}
+
+template<typename V, typename W>
+V fastbc::LocalSubGraph<V, W>::localIndex(V vertex) const
+{
+	if (_contiguous)
+	{
+		return vertex - _globalIndex.front();
+	}
+
+	return std::lower_bound(_globalIndex.begin(), _globalIndex.end(), vertex) - _globalIndex.begin();
+}
+
+template<typename V, typename W>
+V fastbc::LocalSubGraph<V, W>::globalIndex(V local) const
+{
+	return _globalIndex[local];
+}
+
+template<typename V, typename W>
+fastbc::Star<V, W> fastbc::LocalSubGraph<V, W>::localForwardStar(V local) const
+{
+	size_t begin = _forward.offsets[local];
+	return Star<V, W>(_forward.localVertices.data() + begin, _forward.weights.data() + begin,
+		_forward.offsets[local + 1] - begin);
+}
+
+template<typename V, typename W>
+fastbc::Star<V, W> fastbc::LocalSubGraph<V, W>::localBackwardStar(V local) const
+{
+	size_t begin = _backward.offsets[local];
+	return Star<V, W>(_backward.localVertices.data() + begin, _backward.weights.data() + begin,
+		_backward.offsets[local + 1] - begin);
+}
+
+template<typename V, typename W>
+const std::vector<V>& fastbc::LocalSubGraph<V, W>::localBorders() const
+{
+	return _localBorders;
+}
+
+template<typename V, typename W>
+bool fastbc::LocalSubGraph<V, W>::_append(const Star<V, W>& star, local_stars_t& stars) const
+{
+	bool crossing = false;
+
+	// Adjacent vertices are sorted by global index, hence by local index too
+	for (size_t i = 0; i < star.size(); ++i)
+	{
+		if (contains(star.vertex(i)))
+		{
+			stars.localVertices.push_back(localIndex(star.vertex(i)));
+			stars.globalVertices.push_back(star.vertex(i));
+			stars.weights.push_back(star.weight(i));
+		}
+		else
+		{
+			crossing = true;
+		}
+	}
+
+	stars.offsets.push_back(stars.localVertices.size());
+
+	return crossing;
+}
+
+#endif
@@ -0,0 +1,455 @@
+#ifndef FASTBC_MAPPED_CSR_GRAPH_H
+#define FASTBC_MAPPED_CSR_GRAPH_H
+
+#include <IDegreeGraph.h>
+#include <MappedFile.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace fastbc {
+
+	/**
+	 *	@brief Read-only CSR graph opened from a binary graph file without copying it
+	 *
+	 *	@details The binary format stores, in host byte order, a 64 bytes header
+	 *			 followed by these sections, each one starting at a 64 bytes boundary:
+	 *			 - total weight (W)
+	 *			 - forward star offsets (uint64_t, vertices + 1)
+	 *			 - forward star vertices (V, edges) and weights (W, edges)
+	 *			 - backward star offsets (uint64_t, vertices + 1)
+	 *			 - backward star vertices (V, edges) and weights (W, edges)
+	 *			 - in and out weighted degrees (W, vertices each)
+	 *			 Stars returned by the graph point directly into the shared file mapping,
+	 *			 so processes opening the same file share its page cache.
+	 *
+	 *	@tparam V Type for vertex index number
+	 *	@tparam W Type for edge weight value
+	 */
+	template<typename V, typename W>
+	class MappedCSRGraph : public IDegreeGraph<V, W>
+	{
+	public:
+		/**
+		 *	@brief Open a binary graph file
+		 *
+		 *	@param path Binary graph file path
+		 */
+		MappedCSRGraph(const std::string& path);
+
+		/**
+		 *	@brief Check if given file starts with a binary graph header
+		 *
+		 *	@param path File path
+		 *	@return True if the file is a binary graph, false else
+		 */
+		static bool isBinaryGraph(const std::string& path);
+
+		/**
+		 *	@brief Store given graph with binary format
+		 *
+		 *	@note Stars of given graph must be sorted by adjacent vertex
+		 *
+		 *	@param graph Graph to store
+		 *	@param path Output binary graph file path
+		 */
+		static void save(const IDegreeGraph<V, W>& graph, const std::string& path);
+
+		W edge(V src, V dest) const override;
+
+		Star<V, W> forwardStar(V src) const override;
+
+		Star<V, W> backwardStar(V dest) const override;
+
+		const std::vector<V>& vertices() const override;
+
+		V edges() const override;
+
+		/**
+		 *	@brief Not supported, mapped graphs are read-only
+		 */
+		void addEdge(V from, V to, W weight) override;
+
+		void initVertices() override;
+
+		W totalWeight() const override;
+
+		W inWeightedDegree(V v) const override;
+
+		W outWeightedDegree(V v) const override;
+
+	private:
+
+		struct header_t
+		{
+			char magic[8];
+			uint32_t version;
+			uint8_t vertexSize;
+			uint8_t vertexSigned;
+			uint8_t weightSize;
+			uint8_t weightFloating;
+			uint64_t vertexCount;
+			uint64_t edgeCount;
+			uint8_t reserved[32];
+		};
+		static_assert(sizeof(header_t) == 64, "Binary graph header must be 64 bytes long");
+
+		struct layout_t
+		{
+			size_t totalWeight;
+			size_t forwardOffsets;
+			size_t forwardVertices;
+			size_t forwardWeights;
+			size_t backwardOffsets;
+			size_t backwardVertices;
+			size_t backwardWeights;
+			size_t inWeightedDegrees;
+			size_t outWeightedDegrees;
+			size_t size;
+
+			layout_t(uint64_t vertexCount, uint64_t edgeCount);
+		};
+
+		static constexpr char _magic[8] = { 'F', 'A', 'S', 'T', 'B', 'C', 'G', '\0' };
+		static constexpr uint32_t _version = 1;
+
+		static header_t _header(uint64_t vertexCount, uint64_t edgeCount);
+
+		// Check that star offsets delimit edgeCount adjacent vertices, all below vertexCount
+		static bool _validStars(
+			const uint64_t* offsets,
+			const V* vertices,
+			uint64_t vertexCount,
+			uint64_t edgeCount);
+
+		const MappedFile _file;
+		V _edges;
+		W _totalWeight;
+		std::vector<V> _vertices;
+		const uint64_t* _forwardOffsets;
+		const V* _forwardVertices;
+		const W* _forwardWeights;
+		const uint64_t* _backwardOffsets;
+		const V* _backwardVertices;
+		const W* _backwardWeights;
+		const W* _inWeightedDegrees;
+		const W* _outWeightedDegrees;
+	};
+
+}
+
+template<typename V, typename W>
+fastbc::MappedCSRGraph<V, W>::layout_t::layout_t(uint64_t vertexCount, uint64_t edgeCount)
+{
+	size_t offset = sizeof(header_t);
+	auto section = [&offset](size_t bytes) {
+		size_t begin = (offset + 63) / 64 * 64;
+		offset = begin + bytes;
+		return begin;
+	};
+
+	totalWeight = section(sizeof(W));
+	forwardOffsets = section((vertexCount + 1) * sizeof(uint64_t));
+	forwardVertices = section(edgeCount * sizeof(V));
+	forwardWeights = section(edgeCount * sizeof(W));
+	backwardOffsets = section((vertexCount + 1) * sizeof(uint64_t));
+	backwardVertices = section(edgeCount * sizeof(V));
+	backwardWeights = section(edgeCount * sizeof(W));
+	inWeightedDegrees = section(vertexCount * sizeof(W));
+	outWeightedDegrees = section(vertexCount * sizeof(W));
+	size = offset;
+}
+
+template<typename V, typename W>
+typename fastbc::MappedCSRGraph<V, W>::header_t
+fastbc::MappedCSRGraph<V, W>::_header(uint64_t vertexCount, uint64_t edgeCount)
+{
+	header_t header;
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, _magic, sizeof(_magic));
+	header.version = _version;
+	header.vertexSize = sizeof(V);
+	header.vertexSigned = std::is_signed<V>::value;
+	header.weightSize = sizeof(W);
+	header.weightFloating = std::is_floating_point<W>::value;
+	header.vertexCount = vertexCount;
+	header.edgeCount = edgeCount;
+
+	return header;
+}
+
+template<typename V, typename W>
+fastbc::MappedCSRGraph<V, W>::MappedCSRGraph(const std::string& path)
+	: _file(path)
+{
+	if (_file.size() < sizeof(header_t))
+	{
+		throw std::invalid_argument("File \"" + path + "\" is not a binary graph");
+	}
+
+	header_t header;
+	std::memcpy(&header, _file.data(), sizeof(header));
+
+	header_t expected = _header(header.vertexCount, header.edgeCount);
+	if (std::memcmp(header.magic, _magic, sizeof(_magic)) != 0 || header.version != _version)
+	{
+		throw std::invalid_argument("File \"" + path + "\" is not a binary graph");
+	}
+
+	if (header.vertexSize != expected.vertexSize || header.vertexSigned != expected.vertexSigned ||
+		header.weightSize != expected.weightSize || header.weightFloating != expected.weightFloating)
+	{
+		throw std::invalid_argument("Binary graph \"" + path + "\" was stored with different vertex/weight types");
+	}
+
+	// Bound counts by file size before computing sections size, which could overflow
+	if (header.vertexCount >= _file.size() / sizeof(uint64_t) || header.edgeCount > _file.size() / sizeof(V))
+	{
+		throw std::invalid_argument("Binary graph \"" + path + "\" is truncated");
+	}
+
+	layout_t layout(header.vertexCount, header.edgeCount);
+	if (_file.size() < layout.size)
+	{
+		throw std::invalid_argument("Binary graph \"" + path + "\" is truncated");
+	}
+
+	const char* data = _file.data();
+	_edges = header.edgeCount;
+	std::memcpy(&_totalWeight, data + layout.totalWeight, sizeof(W));
+	_forwardOffsets = reinterpret_cast<const uint64_t*>(data + layout.forwardOffsets);
+	_forwardVertices = reinterpret_cast<const V*>(data + layout.forwardVertices);
+	_forwardWeights = reinterpret_cast<const W*>(data + layout.forwardWeights);
+	_backwardOffsets = reinterpret_cast<const uint64_t*>(data + layout.backwardOffsets);
+	_backwardVertices = reinterpret_cast<const V*>(data + layout.backwardVertices);
+	_backwardWeights = reinterpret_cast<const W*>(data + layout.backwardWeights);
+	_inWeightedDegrees = reinterpret_cast<const W*>(data + layout.inWeightedDegrees);
+	_outWeightedDegrees = reinterpret_cast<const W*>(data + layout.outWeightedDegrees);
+
+	// Stars are accessed without bounds checks, corrupted offsets or vertices are rejected here
+	if (!_validStars(_forwardOffsets, _forwardVertices, header.vertexCount, header.edgeCount) ||
+		!_validStars(_backwardOffsets, _backwardVertices, header.vertexCount, header.edgeCount))
+	{
+		throw std::invalid_argument("Binary graph \"" + path + "\" has corrupted stars");
+	}
+
+	_vertices.resize(header.vertexCount);
+	initVertices();
+}
+
+template<typename V, typename W>
+bool fastbc::MappedCSRGraph<V, W>::_validStars(
+	const uint64_t* offsets,
+	const V* vertices,
+	uint64_t vertexCount,
+	uint64_t edgeCount)
+{
+	if (offsets[0] != 0 || offsets[vertexCount] != edgeCount)
+	{
+		return false;
+	}
+
+	for (uint64_t v = 0; v < vertexCount; ++v)
+	{
+		if (offsets[v] > offsets[v + 1])
+		{
+			return false;
+		}
+	}
+
+	for (uint64_t e = 0; e < edgeCount; ++e)
+	{
+		if constexpr (std::is_signed<V>::value)
+		{
+			if (vertices[e] < 0)
+			{
+				return false;
+			}
+		}
+
+		if ((uint64_t)vertices[e] >= vertexCount)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template<typename V, typename W>
+bool fastbc::MappedCSRGraph<V, W>::isBinaryGraph(const std::string& path)
+{
+	std::ifstream file(path, std::ifstream::binary);
+	char magic[sizeof(_magic)];
+
+	return file.read(magic, sizeof(magic)) && std::memcmp(magic, _magic, sizeof(_magic)) == 0;
+}
+
+template<typename V, typename W>
+void fastbc::MappedCSRGraph<V, W>::save(const IDegreeGraph<V, W>& graph, const std::string& path)
+{
+	std::ofstream file(path, std::ofstream::binary | std::ofstream::trunc);
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Unable to create file \"" + path + "\"");
+	}
+
+	uint64_t vertexCount = graph.vertices().size();
+	uint64_t edgeCount = graph.edges();
+	layout_t layout(vertexCount, edgeCount);
+
+	auto seek = [&file](size_t offset) {
+		static const char padding[64] = {};
+		file.write(padding, offset - (size_t)file.tellp());
+	};
+	auto write = [&file](const auto* data, size_t count) {
+		file.write(reinterpret_cast<const char*>(data), count * sizeof(*data));
+	};
+
+	header_t header = _header(vertexCount, edgeCount);
+	write(&header, 1);
+
+	seek(layout.totalWeight);
+	W totalWeight = graph.totalWeight();
+	write(&totalWeight, 1);
+
+	// Stars are written by offsets first, then vertices and weights
+	auto writeStars = [&](bool forward, size_t offsets, size_t vertices, size_t weights) {
+		auto star = [&](V v) { return forward ? graph.forwardStar(v) : graph.backwardStar(v); };
+
+		seek(offsets);
+		uint64_t offset = 0;
+		write(&offset, 1);
+		for (uint64_t v = 0; v < vertexCount; ++v)
+		{
+			offset += star(v).size();
+			write(&offset, 1);
+		}
+
+		if (offset != edgeCount)
+		{
+			throw std::invalid_argument("Given graph stars are not consistent with its edges count");
+		}
+
+		seek(vertices);
+		for (uint64_t v = 0; v < vertexCount; ++v)
+		{
+			const auto s = star(v);
+			write(s.vertices(), s.size());
+		}
+
+		seek(weights);
+		for (uint64_t v = 0; v < vertexCount; ++v)
+		{
+			const auto s = star(v);
+			write(s.weights(), s.size());
+		}
+	};
+
+	writeStars(true, layout.forwardOffsets, layout.forwardVertices, layout.forwardWeights);
+	writeStars(false, layout.backwardOffsets, layout.backwardVertices, layout.backwardWeights);
+
+	seek(layout.inWeightedDegrees);
+	for (uint64_t v = 0; v < vertexCount; ++v)
+	{
+		W degree = graph.inWeightedDegree(v);
+		write(&degree, 1);
+	}
+
+	seek(layout.outWeightedDegrees);
+	for (uint64_t v = 0; v < vertexCount; ++v)
+	{
+		W degree = graph.outWeightedDegree(v);
+		write(&degree, 1);
+	}
+
+	if (!file)
+	{
+		throw std::runtime_error("Unable to write file \"" + path + "\"");
+	}
+}
+
+template<typename V, typename W>
+W fastbc::MappedCSRGraph<V, W>::edge(V src, V dest) const
+{
+	const auto fs = forwardStar(src);
+
+	if (auto w = fs.find(dest); w != fs.end())
+	{
+		return w->second;
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+template<typename V, typename W>
+fastbc::Star<V, W> fastbc::MappedCSRGraph<V, W>::forwardStar(V src) const
+{
+	uint64_t begin = _forwardOffsets[src];
+	return Star<V, W>(_forwardVertices + begin, _forwardWeights + begin,
+		_forwardOffsets[src + 1] - begin);
+}
+
+template<typename V, typename W>
+fastbc::Star<V, W> fastbc::MappedCSRGraph<V, W>::backwardStar(V dest) const
+{
+	uint64_t begin = _backwardOffsets[dest];
+	return Star<V, W>(_backwardVertices + begin, _backwardWeights + begin,
+		_backwardOffsets[dest + 1] - begin);
+}
+
+template<typename V, typename W>
+const std::vector<V>& fastbc::MappedCSRGraph<V, W>::vertices() const
+{
+	return _vertices;
+}
+
+template<typename V, typename W>
+V fastbc::MappedCSRGraph<V, W>::edges() const
+{
+	return _edges;
+}
+
+template<typename V, typename W>
+void fastbc::MappedCSRGraph<V, W>::addEdge(V, V, W)
+{
+	throw std::logic_error("Mapped graphs are read-only");
+}
+
+template<typename V, typename W>
+void fastbc::MappedCSRGraph<V, W>::initVertices()
+{
+	#pragma omp simd
+	for (size_t v = 0; v < _vertices.size(); v++)
+	{
+		_vertices[v] = v;
+	}
+}
+
+template<typename V, typename W>
+W fastbc::MappedCSRGraph<V, W>::totalWeight() const
+{
+	return _totalWeight;
+}
+
+template<typename V, typename W>
+W fastbc::MappedCSRGraph<V, W>::inWeightedDegree(V v) const
+{
+	return _inWeightedDegrees[v];
+}
+
+template<typename V, typename W>
+W fastbc::MappedCSRGraph<V, W>::outWeightedDegree(V v) const
+{
+	return _outWeightedDegrees[v];
+}
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef FASTBC_MAPPED_FILE_H
+#define FASTBC_MAPPED_FILE_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace fastbc {
+
+	/**
+	 *	@brief Read-only memory mapping of a whole file
+	 *
+	 *	@details The file is mapped as shared, so that concurrent processes mapping
+	 *			 the same file share the same page cache. Mapping is released when
+	 *			 the object is destroyed.
+	 */
+	class MappedFile
+	{
+	public:
+		/**
+		 *	@brief Map given file in memory
+		 *
+		 *	@param path File path
+		 *	@param sequential Hint the kernel the file will be read sequentially
+		 */
+		MappedFile(const std::string& path, bool sequential = false)
+			: _data(nullptr), _size(0)
+		{
+			int fd = ::open(path.c_str(), O_RDONLY);
+			if (fd < 0)
+			{
+				throw std::runtime_error("Unable to open file \"" + path + "\"");
+			}
+
+			struct stat st;
+			if (::fstat(fd, &st) != 0)
+			{
+				::close(fd);
+				throw std::runtime_error("Unable to read size of file \"" + path + "\"");
+			}
+			_size = st.st_size;
+
+			// Empty files can not be mapped
+			if (_size)
+			{
+				void* data = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+				if (data == MAP_FAILED)
+				{
+					::close(fd);
+					throw std::runtime_error("Unable to map file \"" + path + "\"");
+				}
+
+				_data = static_cast<const char*>(data);
+				::madvise(data, _size, sequential ? MADV_SEQUENTIAL : MADV_NORMAL);
+			}
+
+			::close(fd);
+		}
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		~MappedFile()
+		{
+			if (_data)
+			{
+				::munmap(const_cast<char*>(_data), _size);
+			}
+		}
+
+		/**
+		 *	@brief Get first byte of mapped file
+		 */
+		const char* data() const { return _data; }
+
+		/**
+		 *	@brief Get mapped file size in bytes
+		 */
+		size_t size() const { return _size; }
+
+	private:
+		const char* _data;
+		size_t _size;
+	};
+
+}
+
+#endif
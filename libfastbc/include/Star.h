@@ -0,0 +1,124 @@
+#ifndef FASTBC_STAR_H
+#define FASTBC_STAR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace fastbc {
+
+	/**
+	 *	@brief Read-only view over a vertex star stored as contiguous arrays
+	 *
+	 *	@details A star is described by two parallel arrays holding adjacent vertex
+	 *			 indices and related edge weights. Adjacent vertices are expected to
+	 *			 be sorted in ascending order, so that lookup can be done by binary search.
+	 *			 The view does not own the referenced memory: it is valid as long as
+	 *			 the graph which generated it is alive and unchanged.
+	 *
+	 *	@tparam V Type for vertex index number
+	 *	@tparam W Type for edge weight value
+	 */
+	template<typename V, typename W>
+	class Star
+	{
+	public:
+
+		/**
+		 *	@brief Forward iterator over star vertex/weight pairs
+		 *
+		 *	@note Dereferenced pair is stored inside the iterator, hence references
+		 *		  obtained from it are valid until the iterator is moved
+		 */
+		class iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = std::pair<V, W>;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const value_type*;
+			using reference = const value_type&;
+
+			iterator(const V* vertex, const W* weight)
+				: _vertex(vertex), _weight(weight) {}
+
+			reference operator*() const { _current = { *_vertex, *_weight }; return _current; }
+			pointer operator->() const { return &**this; }
+
+			iterator& operator++() { ++_vertex; ++_weight; return *this; }
+			iterator operator++(int) { iterator it(*this); ++*this; return it; }
+
+			bool operator==(const iterator& other) const { return _vertex == other._vertex; }
+			bool operator!=(const iterator& other) const { return _vertex != other._vertex; }
+
+		private:
+			const V* _vertex;
+			const W* _weight;
+			mutable value_type _current;
+		};
+
+		Star() : _vertices(nullptr), _weights(nullptr), _size(0) {}
+
+		/**
+		 *	@brief Initialize a star view over given arrays
+		 *
+		 *	@param vertices First adjacent vertex index
+		 *	@param weights First edge weight, parallel to vertices
+		 *	@param size Number of adjacent vertices
+		 */
+		Star(const V* vertices, const W* weights, size_t size)
+			: _vertices(vertices), _weights(weights), _size(size) {}
+
+		/**
+		 *	@brief Get number of adjacent vertices in this star
+		 */
+		size_t size() const { return _size; }
+
+		bool empty() const { return _size == 0; }
+
+		/**
+		 *	@brief Get contiguous array of adjacent vertex indices, size() long
+		 */
+		const V* vertices() const { return _vertices; }
+
+		/**
+		 *	@brief Get contiguous array of edge weights, parallel to vertices()
+		 */
+		const W* weights() const { return _weights; }
+
+		V vertex(size_t i) const { return _vertices[i]; }
+
+		W weight(size_t i) const { return _weights[i]; }
+
+		iterator begin() const { return iterator(_vertices, _weights); }
+
+		iterator end() const { return iterator(_vertices + _size, _weights + _size); }
+
+		/**
+		 *	@brief Search given adjacent vertex in this star
+		 *
+		 *	@param vertex Adjacent vertex index
+		 *	@return iterator Iterator to vertex/weight pair, end() if vertex is not adjacent
+		 */
+		iterator find(V vertex) const
+		{
+			const V* v = std::lower_bound(_vertices, _vertices + _size, vertex);
+
+			if (v != _vertices + _size && *v == vertex)
+			{
+				return iterator(v, _weights + (v - _vertices));
+			}
+
+			return end();
+		}
+
+	private:
+		const V* _vertices;
+		const W* _weights;
+		size_t _size;
+	};
+
+}
+
+#endif
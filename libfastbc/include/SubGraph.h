@@ -4,7 +4,7 @@
 #include "IGraph.h"
 #include "ISubGraph.h"
 
-#include <map>
+#include <algorithm>
 #include <memory>
 #include <set>
 #include <spdlog/spdlog.h>
@@ -31,9 +31,9 @@ namespace fastbc {
 
 		W edge(V src, V dest) const override;
 
-		const std::map<V, W>& forwardStar(V src) const override;
+		Star<V, W> forwardStar(V src) const override;
 
-		const std::map<V, W>& backwardStar(V dest) const override;
+		Star<V, W> backwardStar(V dest) const override;
 
 		const std::vector<V>& vertices() const override;
 
@@ -46,11 +46,27 @@ namespace fastbc {
 		std::shared_ptr<const IGraph<V, W>> referenceGraph() const override;
 
 	private:
+		/*
+		 *	@brief Contiguous storage of sub-graph consistent stars for border vertices
+		 */
+		struct border_stars_t
+		{
+			std::vector<V> owners;
+			std::vector<size_t> offsets = std::vector<size_t>(1, 0);
+			std::vector<V> vertices;
+			std::vector<W> weights;
+
+			template<typename Membership>
+			size_t append(V owner, const Star<V, W>& star, Membership isMember);
+
+			bool find(V owner, Star<V, W>& star) const;
+		};
+
 		const std::shared_ptr<const IGraph<V, W>> _referenceGraph;
 		const std::vector<V> _vertices;
 		V _edges;
-		std::map<V, std::map<V, W>> _borderDestWeight;
-		std::map<V, std::map<V, W>> _borderSrcWeight;
+		border_stars_t _borderDestWeight;
+		border_stars_t _borderSrcWeight;
 		std::set<V> _borderVertices;
 	};
 
@@ -65,71 +81,70 @@ fastbc::SubGraph<V, W>::SubGraph(
 	_edges(0)
 {
 	// Order sub-graph vertices to speed-up border vertices computation
-	std::set orderedVertices(_vertices.begin(), _vertices.end());
+	std::vector<V> orderedVertices(_vertices);
+	std::sort(orderedVertices.begin(), orderedVertices.end());
+
+	// Reordered graphs often map a cluster to a contiguous range of vertices,
+	// turning membership test into a range check
+	bool contiguous = !orderedVertices.empty() &&
+		(size_t)(orderedVertices.back() - orderedVertices.front()) + 1 == orderedVertices.size();
+	auto isMember = [&](V vertex) {
+		return contiguous
+			? orderedVertices.front() <= vertex && vertex <= orderedVertices.back()
+			: std::binary_search(orderedVertices.begin(), orderedVertices.end(), vertex);
+	};
 
-	for (size_t vIndex = 0; vIndex < _vertices.size(); ++vIndex)
+	// Visit vertices in order so that border stars are stored sorted by owner
+	for (size_t vIndex = 0; vIndex < orderedVertices.size(); ++vIndex)
 	{
-		const V& v = _vertices[vIndex];
+		const V& v = orderedVertices[vIndex];
 
 		// Check vertex forward star for edges terminating outside the graph
-		const auto& fs = _referenceGraph->forwardStar(v);
+		const auto fs = _referenceGraph->forwardStar(v);
 
 		bool isBorder = false;
 		V connections = 0;
-		std::vector<V> outEdges;
+		size_t outEdges = 0;
 
-		for (auto& e : fs)
+		for (size_t i = 0; i < fs.size(); ++i)
 		{
-			// When a vertex has an edge outside the sub-graph set it as border and store outgoing edge
-			if (auto dest = orderedVertices.find(e.first); dest == orderedVertices.end())
+			// When a vertex has an edge outside the sub-graph set it as border and count outgoing edge
+			if (!isMember(fs.vertex(i)))
 			{
 				isBorder = true;
-				outEdges.push_back(e.first);
+				++outEdges;
 			}
 		}
 
 		// If vertex has been detected as border store a consistent forward star contained in sub-graph
 		if (isBorder)
 		{
-			// Copy forward star from reference graph removing each unnecessary outgoing edge
-			_borderDestWeight[v] = std::map<V, W>(fs);
-			for (auto& out : outEdges)
-			{
-				_borderDestWeight[v].erase(out);
-			}
-			connections += _borderDestWeight[v].size();
+			connections += _borderDestWeight.append(v, fs, isMember);
 
 			_borderVertices.insert(v);
 		}
 
 		// Update sub-graph edges counter
-		_edges += fs.size() - outEdges.size();
+		_edges += fs.size() - outEdges;
 
 		// Reset border variable for backward star check
 		isBorder = false;
-		outEdges.clear();
 
 		// Check backward star for edges coming from outside the graph
-		const auto& bs = _referenceGraph->backwardStar(v);
-		for (auto& e : bs)
+		const auto bs = _referenceGraph->backwardStar(v);
+		for (size_t i = 0; i < bs.size(); ++i)
 		{
-			if (auto src = orderedVertices.find(e.first); src == orderedVertices.end())
+			if (!isMember(bs.vertex(i)))
 			{
 				isBorder = true;
-				outEdges.push_back(e.first);
+				break;
 			}
 		}
 
 		// If vertex has been detected as border store a consistent backward star contained in sub-graph
 		if (isBorder)
 		{
-			// Copy backward star from reference graph removing each unnecessary external edge
-			_borderSrcWeight[v] = std::map<V, W>(bs);
-			for (auto& out : outEdges)
-			{
-				_borderSrcWeight[v].erase(out);
-			}
-			connections += _borderSrcWeight[v].size();
+			connections += _borderSrcWeight.append(v, bs, isMember);
 
 			_borderVertices.insert(v);
 		}
@@ -150,7 +165,7 @@ fastbc::SubGraph<V, W>::SubGraph(
 template<typename V, typename W>
 W fastbc::SubGraph<V, W>::edge(V src, V dest) const
 {
-	const auto& fs = forwardStar(src);
+	const auto fs = forwardStar(src);
 
 	if (auto w = fs.find(dest); w != fs.end())
 	{
@@ -163,11 +178,11 @@ W fastbc::SubGraph<V, W>::edge(V src, V dest) const
 }
 
 template<typename V, typename W>
-const std::map<V, W>& fastbc::SubGraph<V, W>::forwardStar(V src) const
+fastbc::Star<V, W> fastbc::SubGraph<V, W>::forwardStar(V src) const
 {
-	if (auto border = _borderDestWeight.find(src); border != _borderDestWeight.end())
+	if (Star<V, W> border; _borderDestWeight.find(src, border))
 	{
-		return border->second;
+		return border;
 	}
 	else
 	{
@@ -176,11 +191,11 @@ const std::map<V, W>& fastbc::SubGraph<V, W>::forwardStar(V src) const
 }
 
 template<typename V, typename W>
-const std::map<V, W>& fastbc::SubGraph<V, W>::backwardStar(V dest) const
+fastbc::Star<V, W> fastbc::SubGraph<V, W>::backwardStar(V dest) const
 {
-	if (auto border = _borderSrcWeight.find(dest); border != _borderSrcWeight.end())
+	if (Star<V, W> border; _borderSrcWeight.find(dest, border))
 	{
-		return border->second;
+		return border;
 	}
 	else
 	{
@@ -218,4 +233,42 @@ std::shared_ptr<const fastbc::IGraph<V, W>> fastbc::SubGraph<V, W>::referenceGra
 	return _referenceGraph;
 }
 
+template<typename V, typename W>
+template<typename Membership>
+size_t fastbc::SubGraph<V, W>::border_stars_t::append(
+	V owner, 
+	const Star<V, W>& star, 
+	Membership isMember)
+{
+	// Copy star from reference graph skipping each edge leaving the sub-graph
+	for (size_t i = 0; i < star.size(); ++i)
+	{
+		if (isMember(star.vertex(i)))
+		{
+			vertices.push_back(star.vertex(i));
+			weights.push_back(star.weight(i));
+		}
+	}
+
+	owners.push_back(owner);
+	offsets.push_back(vertices.size());
+
+	return offsets.back() - offsets[offsets.size() - 2];
+}
+
+template<typename V, typename W>
+bool fastbc::SubGraph<V, W>::border_stars_t::find(V owner, Star<V, W>& star) const
+{
+	auto it = std::lower_bound(owners.begin(), owners.end(), owner);
+	if (it == owners.end() || *it != owner)
+	{
+		return false;
+	}
+
+	size_t i = it - owners.begin();
+	star = Star<V, W>(vertices.data() + offsets[i], weights.data() + offsets[i], offsets[i + 1] - offsets[i]);
+
+	return true;
+}
+
 #endif
\ No newline at end of file
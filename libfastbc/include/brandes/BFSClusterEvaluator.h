@@ -0,0 +1,224 @@
+#ifndef FASTBC_BRANDES_BFSCLUSTEREVALUATOR_H
+#define FASTBC_BRANDES_BFSCLUSTEREVALUATOR_H
+
+#include "IClusterEvaluator.h"
+#include <EdgeWeights.h>
+#include <LocalSubGraph.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace fastbc {
+	namespace brandes {
+
+		/**
+		 *	@brief Cluster evaluator computing intra-cluster BC with breadth first searches
+		 *
+		 *	@details Cluster edges are expected to share the same weight, border shortest
+		 *			 path lengths are computed as number of hops times that weight.
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for edge weight value
+		 */
+		template<typename V, typename W>
+		class BFSClusterEvaluator : public IClusterEvaluator<V, W>
+		{
+		public:
+
+			void evaluateCluster(
+				std::vector<W>& clusterBC,
+				VertexInfoMatrix<V, W>& clusterVI,
+				std::shared_ptr<const ISubGraph<V, W>> cluster) override;
+
+		private:
+
+			/*
+			 *	@brief Shortest paths information indexed by cluster local vertex
+			 */
+			struct backtrack_info_t
+			{
+				void resize(size_t vertexCount)
+				{
+					dist.resize(vertexCount);
+					sigma.resize(vertexCount);
+					delta.resize(vertexCount);
+					visitStack.reserve(vertexCount);
+				}
+
+				std::vector<W> dist;
+				std::vector<W> sigma;
+				std::vector<W> delta;
+				std::vector<V> visitStack;
+			};
+
+			/*
+			 *	@brief Get shortest paths information of calling thread, sized on given vertices count
+			 */
+			static backtrack_info_t& _local(size_t vertexCount);
+
+			void _bfs_SSSP(
+				VertexInfoMatrix<V, W>& clusterVI,
+				size_t row,
+				V src,
+				W weight,
+				const LocalSubGraph<V, W>& graph,
+				backtrack_info_t& backtrackInfo);
+
+		};
+
+	}
+}
+
+template<typename V, typename W>
+void fastbc::brandes::BFSClusterEvaluator<V, W>::evaluateCluster(
+	std::vector<W>& clusterBC,
+	VertexInfoMatrix<V, W>& clusterVI,
+	std::shared_ptr<const ISubGraph<V, W>> cluster)
+{
+	// Work on local vertex indices, copying the cluster when not already in local form
+	std::shared_ptr<const LocalSubGraph<V, W>> localCluster =
+		std::dynamic_pointer_cast<const LocalSubGraph<V, W>>(cluster);
+	if (!localCluster)
+	{
+		localCluster = std::make_shared<LocalSubGraph<V, W>>(cluster->vertices(), cluster->referenceGraph());
+	}
+
+	// Hop count is converted to distance by the weight shared by cluster edges
+	W weight = EdgeWeights<V, W>(*localCluster).max();
+
+	// One row of vertex information for each cluster vertex
+	clusterVI = VertexInfoMatrix<V, W>(cluster->vertices().size(), localCluster->localBorders().size());
+
+	// BC of cluster vertices, by local index
+	std::vector<W> localBC(cluster->vertices().size(), (W)0);
+
+	// Compute SP from each cluster vertex
+	this->_sourceTasks(cluster->vertices().size(), cluster->vertices().size(), cluster->edges(), localBC,
+		[&](size_t srcIndex, W* _clusterBC)
+		{
+			// Shortest paths and partial dependency of cluster vertices
+			backtrack_info_t& bi = _local(cluster->vertices().size());
+			auto& visitStack = bi.visitStack;
+			auto& dist = bi.dist;
+			auto& sigma = bi.sigma;
+			auto& delta = bi.delta;
+
+			V src = localCluster->localIndex(cluster->vertices()[srcIndex]);
+
+			// Compute shortest path storing border information
+			_bfs_SSSP(clusterVI, srcIndex, src, weight, *localCluster, bi);
+
+			// Reset partial dependency structure before starting
+			std::fill(delta.begin(), delta.end(), 0);
+
+			// Backward visit of each vertex, pulling dependency from its successors
+			while (!visitStack.empty())
+			{
+				V v = visitStack.back();
+				visitStack.pop_back();
+
+				const auto fs = localCluster->localForwardStar(v);
+				const V* fsVertices = fs.vertices();
+				for (size_t i = 0; i < fs.size(); ++i)
+				{
+					V w = fsVertices[i];
+					if (dist[w] == dist[v] + 1)
+					{
+						delta[v] += sigma[v] / sigma[w] * (1.0 + delta[w]);
+					}
+				}
+
+				if (v != src)
+				{
+					_clusterBC[v] += delta[v];
+				}
+			}
+		});
+
+	// Map cluster BC back to global vertex indices
+	for (size_t local = 0; local < localBC.size(); ++local)
+	{
+		clusterBC[localCluster->globalIndex(local)] += localBC[local];
+	}
+}
+
+template<typename V, typename W>
+typename fastbc::brandes::BFSClusterEvaluator<V, W>::backtrack_info_t&
+fastbc::brandes::BFSClusterEvaluator<V, W>::_local(size_t vertexCount)
+{
+	static thread_local backtrack_info_t backtrackInfo;
+
+	if (backtrackInfo.dist.size() != vertexCount)
+	{
+		backtrackInfo.resize(vertexCount);
+	}
+
+	return backtrackInfo;
+}
+
+template<typename V, typename W>
+void fastbc::brandes::BFSClusterEvaluator<V, W>::_bfs_SSSP(
+	VertexInfoMatrix<V, W>& clusterVI,
+	size_t row,
+	V src,
+	W weight,
+	const LocalSubGraph<V, W>& graph,
+	backtrack_info_t& backtrackInfo)
+{
+	auto& visitStack = backtrackInfo.visitStack;
+	auto& dist = backtrackInfo.dist;
+	auto& sigma = backtrackInfo.sigma;
+
+	// Reset hop distances from the source and shortest paths count
+	std::fill(dist.begin(), dist.end(), std::numeric_limits<W>::max());
+	std::fill(sigma.begin(), sigma.end(), 0);
+
+	// Init src information
+	sigma[src] = 1;
+	dist[src] = 0;
+	visitStack.push_back(src);
+
+	// Visit stack is also the BFS queue, each vertex is expanded once in level order
+	for (size_t next = 0; next < visitStack.size(); ++next)
+	{
+		V v = visitStack[next];
+
+		const auto fs = graph.localForwardStar(v);
+		const V* fsVertices = fs.vertices();
+		for (size_t i = 0; i < fs.size(); ++i)
+		{
+			V w = fsVertices[i];
+
+			// Node w found for the first time?
+			if (dist[w] == std::numeric_limits<W>::max())
+			{
+				dist[w] = dist[v] + 1;
+				visitStack.push_back(w);
+			}
+
+			// Is the shortest path to w via v?
+			if (dist[w] == dist[v] + 1)
+			{
+				sigma[w] += sigma[v];
+			}
+		}
+	}
+
+	// Annotate shortest path length and count information from current src to border vertices
+	const auto& borders = graph.localBorders();
+	W* lengths = clusterVI.lengths(row);
+	V* counts = clusterVI.counts(row);
+	for (size_t storeIndex = 0; storeIndex < borders.size(); ++storeIndex)
+	{
+		const V& b = borders[storeIndex];
+
+		// BE AWARE: SP lentgh from unreached border is converted to zero to enable
+		// 			 correct VertexInfo distance computation
+		lengths[storeIndex] = dist[b] != std::numeric_limits<W>::max() ? dist[b] * weight : 0;
+		counts[storeIndex] = sigma[b];
+	}
+}
+
+#endif
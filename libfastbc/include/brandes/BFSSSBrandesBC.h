@@ -0,0 +1,298 @@
+#ifndef FASTBC_BRANDES_BFSSSBRANDESBC_H
+#define FASTBC_BRANDES_BFSSSBRANDESBC_H
+
+#include "ISSBrandesBC.h"
+#include "SSSPWorkspace.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace fastbc {
+	namespace brandes {
+
+		/**
+		 *	@brief Single source Brandes' dependency computation for graphs with uniform edge weights
+		 *
+		 *	@details Shortest paths are computed by a level synchronous breadth first search,
+		 *			 without any priority queue. With direction optimization enabled, levels
+		 *			 with a large frontier are expanded bottom-up, checking unvisited vertices
+		 *			 backward stars, instead of top-down from frontier forward stars.
+		 *			 Dependencies are accumulated pulling them from next level successors,
+		 *			 so that no predecessors list is stored.
+		 *
+		 *	@note Results are exact only for graphs whose edges share the same weight (see EdgeWeights)
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for edge weight value
+		 */
+		template<typename V, typename W>
+		class BFSSSBrandesBC : public ISSBrandesBC<V, W>
+		{
+		public:
+			/**
+			 *	@brief Initialize a breadth first search single source Brandes computer
+			 *
+			 *	@param directionOptimizing Enable bottom-up expansion of large frontiers
+			 */
+			BFSSSBrandesBC(bool directionOptimizing = true);
+
+			std::vector<W> singleSourceBrandes(
+				V source,
+				std::shared_ptr<const IGraph<V, W>> graph) override;
+
+			void accumulateBrandes(
+				V source,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				W scale,
+				W* bc) override;
+
+			W accumulateWeightedBrandes(
+				V source,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				const std::vector<W>& vertexWeights,
+				W scale,
+				W* bc,
+				W* reached) override;
+
+		private:
+			// Switch to bottom-up when frontier edges exceed unexplored edges divided by alpha
+			static constexpr size_t _alpha = 14;
+
+			// Switch back to top-down when frontier is smaller than vertices divided by beta
+			static constexpr size_t _beta = 24;
+
+			const bool _directionOptimizing;
+
+			void _bfs_SSSP(
+				V src,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				SSSPWorkspace<V, W>& workspace);
+
+			W _accumulate(
+				V source,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				const W* vertexWeights,
+				W scale,
+				W* bc,
+				W* reached);
+		};
+
+	}
+}
+
+template<typename V, typename W>
+fastbc::brandes::BFSSSBrandesBC<V, W>::BFSSSBrandesBC(bool directionOptimizing)
+	: _directionOptimizing(directionOptimizing)
+{
+}
+
+template<typename V, typename W>
+std::vector<W> fastbc::brandes::BFSSSBrandesBC<V, W>::singleSourceBrandes(
+	V source,
+	std::shared_ptr<const IGraph<V, W>> graph)
+{
+	std::vector<W> ssBC(graph->vertices().size(), (W)0);
+
+	accumulateBrandes(source, graph, 1, ssBC.data());
+
+	return ssBC;
+}
+
+template<typename V, typename W>
+void fastbc::brandes::BFSSSBrandesBC<V, W>::accumulateBrandes(
+	V source,
+	std::shared_ptr<const IGraph<V, W>> graph,
+	W scale,
+	W* bc)
+{
+	_accumulate(source, graph, nullptr, scale, bc, nullptr);
+}
+
+template<typename V, typename W>
+W fastbc::brandes::BFSSSBrandesBC<V, W>::accumulateWeightedBrandes(
+	V source,
+	std::shared_ptr<const IGraph<V, W>> graph,
+	const std::vector<W>& vertexWeights,
+	W scale,
+	W* bc,
+	W* reached)
+{
+	return _accumulate(source, graph, vertexWeights.data(), scale, bc, reached);
+}
+
+template<typename V, typename W>
+W fastbc::brandes::BFSSSBrandesBC<V, W>::_accumulate(
+	V source,
+	std::shared_ptr<const IGraph<V, W>> graph,
+	const W* vertexWeights,
+	W scale,
+	W* bc,
+	W* reached)
+{
+	// Shortest paths buffers are allocated once per thread and reused between sources
+	SSSPWorkspace<V, W>& workspace = SSSPWorkspace<V, W>::local();
+	workspace.prepare(graph->vertices().size());
+
+	// Distance is stored as number of hops from source
+	_bfs_SSSP(source, graph, workspace);
+	const auto& visitStack = workspace.visitStack;
+	const auto& dist = workspace.dist;
+	const auto& sigma = workspace.sigma;
+	auto& delta = workspace.delta;
+
+	// Without vertex weights each vertex stands for itself only
+	W sourceWeight = vertexWeights ? vertexWeights[source] : 1;
+
+	// Backward visit of each vertex, pulling dependency from its successors
+	for (auto it = visitStack.rbegin(); it != visitStack.rend(); ++it)
+	{
+		V v = *it;
+
+		const auto fs = graph->forwardStar(v);
+		const V* fsVertices = fs.vertices();
+		for (size_t i = 0; i < fs.size(); ++i)
+		{
+			V w = fsVertices[i];
+			if (dist[w] == dist[v] + 1)
+			{
+				W weight = vertexWeights ? vertexWeights[w] : 1;
+				delta[v] += sigma[v] / sigma[w] * (weight + delta[w]);
+			}
+		}
+
+		if (v != source)
+		{
+			// Vertices of v group other than v are reached through it
+			W weight = vertexWeights ? vertexWeights[v] : 1;
+			bc[v] += (delta[v] + (weight - 1)) * sourceWeight * scale;
+
+			if (reached)
+			{
+				reached[v] += sourceWeight * scale;
+			}
+		}
+	}
+
+	// Source is inner vertex of the paths from the other vertices of its group
+	W reach = delta[source];
+	if (sourceWeight != 1)
+	{
+		bc[source] += (sourceWeight - 1) * reach * scale;
+	}
+
+	workspace.release();
+
+	return reach;
+}
+
+template<typename V, typename W>
+void fastbc::brandes::BFSSSBrandesBC<V, W>::_bfs_SSSP(
+	V src,
+	std::shared_ptr<const IGraph<V, W>> graph,
+	SSSPWorkspace<V, W>& workspace)
+{
+	auto& visitStack = workspace.visitStack;
+	auto& dist = workspace.dist;
+	auto& sigma = workspace.sigma;
+	size_t vertexCount = graph->vertices().size();
+
+	// Init src information
+	sigma[src] = 1;
+	dist[src] = 0;
+	visitStack.push_back(src);
+
+	// Vertices of current level lie in visit stack between levelBegin and levelEnd
+	size_t levelBegin = 0;
+	W level = 0;
+	size_t unexploredEdges = graph->edges();
+	bool bottomUp = false;
+
+	while (levelBegin < visitStack.size())
+	{
+		size_t levelEnd = visitStack.size();
+
+		// Choose expansion direction from frontier size
+		if (_directionOptimizing)
+		{
+			size_t frontierEdges = 0;
+			for (size_t i = levelBegin; i < levelEnd; ++i)
+			{
+				frontierEdges += graph->forwardStar(visitStack[i]).size();
+			}
+
+			if (!bottomUp && frontierEdges > unexploredEdges / _alpha)
+			{
+				bottomUp = true;
+			}
+			else if (bottomUp && levelEnd - levelBegin < vertexCount / _beta)
+			{
+				bottomUp = false;
+			}
+
+			unexploredEdges -= std::min(frontierEdges, unexploredEdges);
+		}
+
+		if (!bottomUp)
+		{
+			// Expand each frontier vertex forward star
+			for (size_t i = levelBegin; i < levelEnd; ++i)
+			{
+				V v = visitStack[i];
+
+				const auto fs = graph->forwardStar(v);
+				const V* fsVertices = fs.vertices();
+				for (size_t e = 0; e < fs.size(); ++e)
+				{
+					V w = fsVertices[e];
+
+					// Node w found for the first time?
+					if (dist[w] == std::numeric_limits<W>::max())
+					{
+						dist[w] = level + 1;
+						visitStack.push_back(w);
+					}
+
+					// Is the shortest path to w via v?
+					if (dist[w] == level + 1)
+					{
+						sigma[w] += sigma[v];
+					}
+				}
+			}
+		}
+		else
+		{
+			// Look for frontier predecessors of each unvisited vertex
+			for (size_t w = 0; w < vertexCount; ++w)
+			{
+				if (dist[w] != std::numeric_limits<W>::max())
+				{
+					continue;
+				}
+
+				const auto bs = graph->backwardStar(w);
+				const V* bsVertices = bs.vertices();
+				for (size_t e = 0; e < bs.size(); ++e)
+				{
+					if (dist[bsVertices[e]] == level)
+					{
+						sigma[w] += sigma[bsVertices[e]];
+					}
+				}
+
+				if (sigma[w] != 0)
+				{
+					dist[w] = level + 1;
+					visitStack.push_back(w);
+				}
+			}
+		}
+
+		levelBegin = levelEnd;
+		level += 1;
+	}
+}
+
+#endif
@@ -0,0 +1,498 @@
+#ifndef FASTBC_BRANDES_BLOCKBRANDESBC_H
+#define FASTBC_BRANDES_BLOCKBRANDESBC_H
+
+#include "BFSSSBrandesBC.h"
+#include "DijkstraSSBrandesBC.h"
+#include "IBrandesBC.h"
+#include "ISSBrandesBC.h"
+#include "ParallelAccumulator.h"
+#include <CSRGraph.h>
+#include <EdgeWeights.h>
+#include <queue/BucketQueue.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <spdlog/spdlog.h>
+#include <utility>
+#include <vector>
+
+namespace fastbc {
+	namespace brandes {
+
+		/**
+		 *	@brief Exact betweenness centrality computed independently on each block of the graph
+		 *
+		 *	@details On graphs whose edges are all paired with a reverse edge, the graph is
+		 *			 split in biconnected blocks joined by articulation vertices. Within a
+		 *			 block, each articulation vertex stands for the vertices beyond it,
+		 *			 counted on the block-cut tree, and weighted Brandes' dependencies are
+		 *			 computed on the block only (see ISSBrandesBC::accumulateWeightedBrandes).
+		 *			 Paths between vertices beyond different blocks of an articulation vertex
+		 *			 are counted once, from the blocks of their source.
+		 *			 On other graphs shortest paths may leave and enter a block through
+		 *			 different vertices, so the graph is only split in weakly connected
+		 *			 components. Block sources are computed in parallel, from the largest
+		 *			 block, and blocks of two vertices are evaluated without visits.
+		 *			 Blocks whose edges share the same weight are visited by breadth first
+		 *			 search, blocks with small integer weights by Dijkstra's algorithm with
+		 *			 a bucket queue.
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for edge weight value
+		 */
+		template<typename V, typename W>
+		class BlockBrandesBC : public IBrandesBC<V, W>
+		{
+		public:
+			/**
+			 *	@brief Initialize a block decomposed BC computer
+			 *
+			 *	@param ssb Single source Brandes computer used on blocks with other weights
+			 */
+			BlockBrandesBC(std::shared_ptr<ISSBrandesBC<V, W>> ssb);
+
+			std::vector<W> computeBC(const std::shared_ptr<const IGraph<V, W>> graph) override;
+
+		private:
+			static constexpr size_t none = std::numeric_limits<size_t>::max();
+
+			std::shared_ptr<ISSBrandesBC<V, W>> _ssb;
+
+			/*
+			 *	@brief Split graph in biconnected blocks, by Hopcroft-Tarjan depth first search
+			 */
+			void _biconnectedBlocks(
+				const IGraph<V, W>& graph,
+				std::vector<std::vector<V>>& blocks);
+
+			/*
+			 *	@brief Split graph in weakly connected components
+			 */
+			void _weakComponents(
+				const IGraph<V, W>& graph,
+				std::vector<std::vector<V>>& blocks);
+
+			/*
+			 *	@brief Compute number of vertices each block vertex stands for, on the block-cut tree
+			 */
+			void _blockWeights(
+				size_t vertexCount,
+				const std::vector<std::vector<V>>& blocks,
+				std::vector<std::vector<W>>& weights);
+		};
+
+	}
+}
+
+template<typename V, typename W>
+fastbc::brandes::BlockBrandesBC<V, W>::BlockBrandesBC(
+	std::shared_ptr<ISSBrandesBC<V, W>> ssb)
+	: _ssb(ssb)
+{
+}
+
+template<typename V, typename W>
+std::vector<W> fastbc::brandes::BlockBrandesBC<V, W>::computeBC(
+	const std::shared_ptr<const IGraph<V, W>> graph)
+{
+	size_t vertexCount = graph->vertices().size();
+
+	// Every edge must be paired with a reverse edge to split at articulation vertices
+	bool symmetric = true;
+	#pragma omp parallel for schedule(dynamic, 1024) reduction(&&:symmetric)
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		const auto fs = graph->forwardStar(v);
+		const auto bs = graph->backwardStar(v);
+		bool paired = fs.size() == bs.size();
+		for (size_t i = 0; i < fs.size() && paired; ++i)
+		{
+			paired = bs.find(fs.vertex(i)) != bs.end();
+		}
+		symmetric = symmetric && paired;
+	}
+
+	std::vector<std::vector<V>> blocks;
+	std::vector<std::vector<W>> weights;
+	if (symmetric)
+	{
+		_biconnectedBlocks(*graph, blocks);
+		_blockWeights(vertexCount, blocks, weights);
+	}
+	else
+	{
+		_weakComponents(*graph, blocks);
+		for (const auto& block : blocks)
+		{
+			weights.emplace_back(block.size(), 1);
+		}
+	}
+
+	SPDLOG_INFO("Graph split in {} {}", blocks.size(), symmetric ? "biconnected blocks" : "weakly connected components");
+
+	std::vector<W> bc(vertexCount, (W)0);
+
+	// Blocks of two vertices only hold paths ending in their vertices
+	std::vector<size_t> blockOrder;
+	for (size_t b = 0; b < blocks.size(); ++b)
+	{
+		if (blocks[b].size() == 2 && symmetric)
+		{
+			bc[blocks[b][0]] += weights[b][1] * (weights[b][0] - 1);
+			bc[blocks[b][1]] += weights[b][0] * (weights[b][1] - 1);
+		}
+		else if (blocks[b].size() > 2)
+		{
+			blockOrder.push_back(b);
+		}
+	}
+
+	// Largest blocks are computed first, to balance threads load
+	std::sort(blockOrder.begin(), blockOrder.end(),
+		[&blocks](size_t b1, size_t b2) { return blocks[b1].size() > blocks[b2].size(); });
+
+	// Build block graphs on local vertex indices, an edge belongs to a single block
+	std::vector<std::shared_ptr<const IGraph<V, W>>> blockGraphs(blocks.size());
+	std::vector<std::shared_ptr<ISSBrandesBC<V, W>>> blockSSB(blocks.size());
+	std::vector<size_t> tasksOffset(1, 0);
+	std::vector<size_t> localIndex(vertexCount, none);
+	for (size_t b : blockOrder)
+	{
+		const auto& block = blocks[b];
+		for (size_t i = 0; i < block.size(); ++i)
+		{
+			localIndex[block[i]] = i;
+		}
+
+		std::vector<V> src;
+		std::vector<V> dest;
+		std::vector<W> weight;
+		for (size_t i = 0; i < block.size(); ++i)
+		{
+			const auto fs = graph->forwardStar(block[i]);
+			for (size_t e = 0; e < fs.size(); ++e)
+			{
+				if (localIndex[fs.vertex(e)] != none)
+				{
+					src.push_back(i);
+					dest.push_back(localIndex[fs.vertex(e)]);
+					weight.push_back(fs.weight(e));
+				}
+			}
+		}
+
+		for (V v : block)
+		{
+			localIndex[v] = none;
+		}
+
+		blockGraphs[b] = std::make_shared<CSRGraph<V, W>>(std::move(src), std::move(dest), std::move(weight));
+
+		// Select single source computer by block edge weights
+		EdgeWeights<V, W> blockWeights(*blockGraphs[b]);
+		if (blockWeights.uniform())
+		{
+			blockSSB[b] = std::make_shared<BFSSSBrandesBC<V, W>>();
+		}
+		else if (blockWeights.bucketQueue())
+		{
+			blockSSB[b] = std::make_shared<DijkstraSSBrandesBC<V, W, queue::BucketQueue<V, W>>>();
+		}
+		else
+		{
+			blockSSB[b] = _ssb;
+		}
+
+		tasksOffset.push_back(tasksOffset.back() + block.size());
+	}
+
+	ParallelAccumulator<W> accumulator(vertexCount);
+
+	#pragma omp parallel
+	{
+		W* _bc = accumulator.local();
+
+		// Sums of the block last computed by this thread, flushed when block changes
+		std::vector<W> blockBC;
+		size_t current = none;
+		auto flush = [&]()
+		{
+			if (current != none)
+			{
+				for (size_t i = 0; i < blocks[current].size(); ++i)
+				{
+					_bc[blocks[current][i]] += blockBC[i];
+				}
+			}
+		};
+
+		// Each task is a source of a block, blocks sources are contiguous
+		#pragma omp for schedule(dynamic, 1)
+		for (size_t task = 0; task < tasksOffset.back(); ++task)
+		{
+			size_t orderIndex = std::upper_bound(tasksOffset.begin(), tasksOffset.end(), task) - tasksOffset.begin() - 1;
+			size_t b = blockOrder[orderIndex];
+			V source = task - tasksOffset[orderIndex];
+
+			if (b != current)
+			{
+				flush();
+				current = b;
+				blockBC.assign(blocks[b].size(), 0);
+			}
+
+			W reach = blockSSB[b]->accumulateWeightedBrandes(
+				source, blockGraphs[b], weights[b], 1, blockBC.data(), nullptr);
+
+			// Paths from vertices beyond the source are counted from their own blocks
+			blockBC[source] -= (weights[b][source] - 1) * reach;
+		}
+
+		flush();
+	}
+
+	accumulator.mergeInto(bc.data());
+
+	return bc;
+}
+
+template<typename V, typename W>
+void fastbc::brandes::BlockBrandesBC<V, W>::_biconnectedBlocks(
+	const IGraph<V, W>& graph,
+	std::vector<std::vector<V>>& blocks)
+{
+	size_t vertexCount = graph.vertices().size();
+
+	// Discovery time and lowest discovery time reachable by a back edge from each subtree
+	std::vector<size_t> discovery(vertexCount, none);
+	std::vector<size_t> low(vertexCount, none);
+	size_t time = 0;
+
+	// Depth first search frames: vertex and next forward star entry to explore
+	std::vector<std::pair<V, size_t>> frames;
+	std::vector<V> visited;
+
+	for (size_t root = 0; root < vertexCount; ++root)
+	{
+		if (discovery[root] != none)
+		{
+			continue;
+		}
+
+		discovery[root] = low[root] = time++;
+		frames.emplace_back(root, 0);
+		visited.push_back(root);
+
+		while (!frames.empty())
+		{
+			V v = frames.back().first;
+			const auto fs = graph.forwardStar(v);
+
+			if (frames.back().second < fs.size())
+			{
+				V w = fs.vertex(frames.back().second++);
+
+				if (discovery[w] == none)
+				{
+					discovery[w] = low[w] = time++;
+					frames.emplace_back(w, 0);
+					visited.push_back(w);
+				}
+				else
+				{
+					low[v] = std::min(low[v], discovery[w]);
+				}
+
+				continue;
+			}
+
+			frames.pop_back();
+			if (frames.empty())
+			{
+				// Isolated root forms no block
+				visited.clear();
+				continue;
+			}
+
+			// Parent of v is an articulation vertex, or the root, if no back edge leaves v subtree
+			V u = frames.back().first;
+			low[u] = std::min(low[u], low[v]);
+			if (low[v] >= discovery[u])
+			{
+				blocks.emplace_back();
+				auto& block = blocks.back();
+
+				V popped;
+				do
+				{
+					popped = visited.back();
+					visited.pop_back();
+					block.push_back(popped);
+				} while (popped != v);
+				block.push_back(u);
+			}
+		}
+
+		visited.clear();
+	}
+}
+
+template<typename V, typename W>
+void fastbc::brandes::BlockBrandesBC<V, W>::_weakComponents(
+	const IGraph<V, W>& graph,
+	std::vector<std::vector<V>>& blocks)
+{
+	size_t vertexCount = graph.vertices().size();
+	std::vector<bool> visited(vertexCount, false);
+
+	for (size_t root = 0; root < vertexCount; ++root)
+	{
+		if (visited[root])
+		{
+			continue;
+		}
+
+		// Component vertices list is also the breadth first search queue
+		std::vector<V> component(1, root);
+		visited[root] = true;
+		for (size_t next = 0; next < component.size(); ++next)
+		{
+			for (const auto& star : { graph.forwardStar(component[next]), graph.backwardStar(component[next]) })
+			{
+				for (size_t i = 0; i < star.size(); ++i)
+				{
+					if (!visited[star.vertex(i)])
+					{
+						visited[star.vertex(i)] = true;
+						component.push_back(star.vertex(i));
+					}
+				}
+			}
+		}
+
+		if (component.size() > 1)
+		{
+			blocks.push_back(std::move(component));
+		}
+	}
+}
+
+template<typename V, typename W>
+void fastbc::brandes::BlockBrandesBC<V, W>::_blockWeights(
+	size_t vertexCount,
+	const std::vector<std::vector<V>>& blocks,
+	std::vector<std::vector<W>>& weights)
+{
+	// Articulation vertices are shared by more blocks
+	std::vector<std::vector<size_t>> vertexBlocks(vertexCount);
+	for (size_t b = 0; b < blocks.size(); ++b)
+	{
+		for (V v : blocks[b])
+		{
+			vertexBlocks[v].push_back(b);
+		}
+	}
+
+	// Vertices in the subtree of each block-cut tree node, rooted at a block of each component
+	std::vector<W> blockSubtree(blocks.size(), 0);
+	std::vector<W> cutSubtree(vertexCount, 1);
+	std::vector<size_t> blockParent(blocks.size(), none);
+	std::vector<size_t> cutParent(vertexCount, none);
+	std::vector<bool> placed(blocks.size(), false);
+
+	// Tree nodes in visit order, as block flag and index
+	std::vector<std::pair<bool, size_t>> order;
+	std::vector<std::pair<bool, size_t>> stack;
+	weights.resize(blocks.size());
+
+	for (size_t root = 0; root < blocks.size(); ++root)
+	{
+		if (placed[root])
+		{
+			continue;
+		}
+
+		order.clear();
+		placed[root] = true;
+		stack.emplace_back(true, root);
+		while (!stack.empty())
+		{
+			auto [isBlock, node] = stack.back();
+			stack.pop_back();
+			order.emplace_back(isBlock, node);
+
+			if (isBlock)
+			{
+				for (V v : blocks[node])
+				{
+					if (vertexBlocks[v].size() > 1 && (size_t)v != blockParent[node])
+					{
+						cutParent[v] = node;
+						stack.emplace_back(false, v);
+					}
+					else if (vertexBlocks[v].size() == 1)
+					{
+						blockSubtree[node] += 1;
+					}
+				}
+			}
+			else
+			{
+				for (size_t b : vertexBlocks[node])
+				{
+					if (b != cutParent[node])
+					{
+						placed[b] = true;
+						blockParent[b] = node;
+						stack.emplace_back(true, b);
+					}
+				}
+			}
+		}
+
+		// Children are visited after their parent
+		for (auto it = order.rbegin(); it != order.rend(); ++it)
+		{
+			if (it->first && blockParent[it->second] != none)
+			{
+				cutSubtree[blockParent[it->second]] += blockSubtree[it->second];
+			}
+			else if (!it->first)
+			{
+				blockSubtree[cutParent[it->second]] += cutSubtree[it->second];
+			}
+		}
+
+		// Articulation vertices stand for the vertices of their subtree, or outside block subtree
+		W componentSize = blockSubtree[root];
+		for (const auto& [isBlock, b] : order)
+		{
+			if (!isBlock)
+			{
+				continue;
+			}
+
+			weights[b].resize(blocks[b].size());
+			for (size_t i = 0; i < blocks[b].size(); ++i)
+			{
+				V v = blocks[b][i];
+				if (vertexBlocks[v].size() == 1)
+				{
+					weights[b][i] = 1;
+				}
+				else if ((size_t)v == blockParent[b])
+				{
+					weights[b][i] = componentSize - blockSubtree[b];
+				}
+				else
+				{
+					weights[b][i] = cutSubtree[v];
+				}
+			}
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,178 @@
+#ifndef FASTBC_BRANDES_BORDERCLUSTEREVALUATOR_H
+#define FASTBC_BRANDES_BORDERCLUSTEREVALUATOR_H
+
+#include "IClusterEvaluator.h"
+#include "SSSPWorkspace.h"
+#include <EdgeWeights.h>
+#include <LocalSubGraph.h>
+#include <queue/BucketQueue.h>
+#include <queue/DefaultQueue.h>
+
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace fastbc {
+	namespace brandes {
+
+		/**
+		 *	@brief Cluster evaluator computing vertices information only, from cluster borders
+		 *
+		 *	@details Shortest paths length and count from each cluster vertex to a border
+		 *			 are computed at once for all vertices by a single Dijkstra's visit of
+		 *			 the reversed cluster (following backward stars) rooted at that border,
+		 *			 so that a cluster is visited once per border instead of once per vertex.
+		 *			 Intra-cluster BC is not computed and given BC values are left untouched:
+		 *			 clustered computations using this evaluator skip the intra-cluster
+		 *			 correction, estimating BC from pivots dependencies only.
+		 *			 Clusters with small integer edge weights are visited with a bucket queue.
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for edge weight value
+		 *	@tparam Queue Priority queue policy used by Dijkstra's algorithm (see queue::SetQueue)
+		 */
+		template<typename V, typename W, typename Queue = queue::DefaultQueue<V, W>>
+		class BorderClusterEvaluator : public IClusterEvaluator<V, W>
+		{
+		public:
+
+			void evaluateCluster(
+				std::vector<W>& clusterBC,
+				VertexInfoMatrix<V, W>& clusterVI,
+				std::shared_ptr<const ISubGraph<V, W>> cluster) override;
+
+			bool computesClusterBC() const override;
+
+		private:
+
+			template<typename Q>
+			void _reverseSSSP(
+				VertexInfoMatrix<V, W>& clusterVI,
+				const std::vector<size_t>& rows,
+				size_t storeIndex,
+				const LocalSubGraph<V, W>& graph);
+
+		};
+
+	}
+}
+
+template<typename V, typename W, typename Queue>
+void fastbc::brandes::BorderClusterEvaluator<V, W, Queue>::evaluateCluster(
+	std::vector<W>&,
+	VertexInfoMatrix<V, W>& clusterVI,
+	std::shared_ptr<const ISubGraph<V, W>> cluster)
+{
+	// Work on local vertex indices, copying the cluster when not already in local form
+	std::shared_ptr<const LocalSubGraph<V, W>> localCluster =
+		std::dynamic_pointer_cast<const LocalSubGraph<V, W>>(cluster);
+	if (!localCluster)
+	{
+		localCluster = std::make_shared<LocalSubGraph<V, W>>(cluster->vertices(), cluster->referenceGraph());
+	}
+
+	// Each border visit fills its own column of cluster vertices information
+	const auto& vertices = cluster->vertices();
+	size_t borderCount = localCluster->localBorders().size();
+	clusterVI = VertexInfoMatrix<V, W>(vertices.size(), borderCount);
+
+	// Row of each local vertex
+	std::vector<size_t> rows(vertices.size());
+	for (size_t row = 0; row < vertices.size(); ++row)
+	{
+		rows[localCluster->localIndex(vertices[row])] = row;
+	}
+
+	// Selected for each cluster, without logging
+	bool bucketQueue = !std::is_same<Queue, queue::BucketQueue<V, W>>::value &&
+		EdgeWeights<V, W>(*cluster).bucketQueue();
+
+	// One reverse visit of the whole cluster for each border
+	this->_sourceTasks(borderCount, vertices.size(), localCluster->edges(),
+		[&](size_t storeIndex)
+		{
+			if (bucketQueue)
+			{
+				_reverseSSSP<queue::BucketQueue<V, W>>(clusterVI, rows, storeIndex, *localCluster);
+			}
+			else
+			{
+				_reverseSSSP<Queue>(clusterVI, rows, storeIndex, *localCluster);
+			}
+		});
+}
+
+template<typename V, typename W, typename Queue>
+bool fastbc::brandes::BorderClusterEvaluator<V, W, Queue>::computesClusterBC() const
+{
+	return false;
+}
+
+template<typename V, typename W, typename Queue>
+template<typename Q>
+void fastbc::brandes::BorderClusterEvaluator<V, W, Queue>::_reverseSSSP(
+	VertexInfoMatrix<V, W>& clusterVI,
+	const std::vector<size_t>& rows,
+	size_t storeIndex,
+	const LocalSubGraph<V, W>& graph)
+{
+	SSSPWorkspace<V, W, Q>& workspace = SSSPWorkspace<V, W, Q>::local();
+	workspace.prepare(graph.vertices().size());
+
+	auto& dist = workspace.dist;
+	auto& sigma = workspace.sigma;
+	auto& visitStack = workspace.visitStack;
+	auto& visitQueue = workspace.visitQueue;
+
+	// Shortest paths to the border are shortest paths from it on the reversed cluster
+	V border = graph.localBorders()[storeIndex];
+	sigma[border] = 1;
+	dist[border] = 0;
+	visitQueue.push(border, 0);
+
+	while (!visitQueue.empty())
+	{
+		V w = visitQueue.pop();
+		visitStack.push_back(w);
+
+		const auto bs = graph.localBackwardStar(w);
+		const V* bsVertices = bs.vertices();
+		const W* bsWeights = bs.weights();
+		for (size_t i = 0; i < bs.size(); ++i)
+		{
+			V v = bsVertices[i];
+			W newDist = dist[w] + bsWeights[i];
+
+			if (newDist < dist[v])
+			{
+				if (dist[v] == std::numeric_limits<W>::max())
+				{
+					visitQueue.push(v, newDist);
+				}
+				else
+				{
+					visitQueue.decrease(v, newDist);
+				}
+				dist[v] = newDist;
+				sigma[v] = 0;
+			}
+
+			if (newDist == dist[v])
+			{
+				sigma[v] += sigma[w];
+			}
+		}
+	}
+
+	// Unreached vertices keep zero length and count, as in DijkstraClusterEvaluator
+	for (V v : visitStack)
+	{
+		clusterVI.lengths(rows[v])[storeIndex] = dist[v];
+		clusterVI.counts(rows[v])[storeIndex] = sigma[v];
+	}
+
+	workspace.release();
+}
+
+#endif
@@ -0,0 +1,587 @@
+#ifndef FASTBC_BRANDES_CHAINCONTRACTEDBRANDESBC_H
+#define FASTBC_BRANDES_CHAINCONTRACTEDBRANDESBC_H
+
+#include "IBrandesBC.h"
+#include "ParallelAccumulator.h"
+#include "SSSPWorkspace.h"
+#include <CSRGraph.h>
+#include <EdgeWeights.h>
+#include <queue/BucketQueue.h>
+#include <queue/DefaultQueue.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <set>
+#include <spdlog/spdlog.h>
+#include <utility>
+#include <vector>
+
+namespace fastbc {
+	namespace brandes {
+
+		/**
+		 *	@brief Exact Brandes' betweenness centrality computed on a graph with chains
+		 *		   of degree 2 vertices contracted to single edges
+		 *
+		 *	@details A chain inner vertex has exactly two neighbours, linked to each of them
+		 *			 in both directions with the same weight. Maximal chains between two
+		 *			 distinct endpoints are replaced by a pair of edges weighted by the chain
+		 *			 length, unless their endpoints are already adjacent or joined by another
+		 *			 contracted chain, so that no parallel edges are created.
+		 *			 Shortest paths are computed on the contracted graph from every vertex:
+		 *			 a chain inner source is seeded at both chain endpoints with its distance
+		 *			 from each of them, and its own chain edges are skipped. Distances and
+		 *			 paths counts to inner targets follow from the ones of their chain
+		 *			 endpoints, and the dependency of inner vertices from the paths counts
+		 *			 entering their chain, as each chain holds a single path.
+		 *			 Chains are contracted only when all edge weights are integral, as
+		 *			 summing fractional chain weights in advance may round shortest paths
+		 *			 lengths differently from paths not contracted, breaking their ties:
+		 *			 other graphs are visited whole, as by ExactBrandesBC.
+		 *			 Graphs with small integer weights are visited by Dijkstra's algorithm
+		 *			 with a bucket queue (see queue::BucketQueue), whatever the Queue policy.
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for edge weight value
+		 *	@tparam Queue Priority queue policy used by Dijkstra's algorithm (see queue::SetQueue)
+		 */
+		template<typename V, typename W, typename Queue = queue::DefaultQueue<V, W>>
+		class ChainContractedBrandesBC : public IBrandesBC<V, W>
+		{
+		public:
+			std::vector<W> computeBC(const std::shared_ptr<const IGraph<V, W>> graph) override;
+
+		private:
+			static constexpr size_t none = std::numeric_limits<size_t>::max();
+
+			/*
+			 *	@brief Contracted chains and graph of the remaining core vertices
+			 */
+			struct contraction_t
+			{
+				// Core graph index of each core vertex
+				std::vector<V> rank;
+				std::vector<V> coreVertices;
+				std::shared_ptr<const IGraph<V, W>> core;
+
+				// Chain of each core graph edge in forward stars order, none for original edges
+				std::vector<size_t> edgeOffset;
+				std::vector<size_t> edgeChain;
+
+				// Core graph index of chain endpoints, and first inner vertex entry of each chain
+				std::vector<V> chainA;
+				std::vector<V> chainB;
+				std::vector<size_t> chainBegin;
+
+				// Inner vertices of all chains from endpoint a to endpoint b, with their
+				// distance from each endpoint
+				std::vector<V> inner;
+				std::vector<W> fromA;
+				std::vector<W> fromB;
+				std::vector<size_t> innerChain;
+
+				// Inner vertices entry of each vertex, none for core vertices
+				std::vector<size_t> innerEntry;
+			};
+
+			contraction_t _contract(const IGraph<V, W>& graph);
+
+			template<typename Q>
+			std::vector<W> _brandes(const contraction_t& contraction);
+
+			template<typename Q>
+			void _dijkstra_SSSP(
+				const contraction_t& contraction,
+				size_t skipChain,
+				SSSPWorkspace<V, W, Q>& workspace);
+		};
+
+	}
+}
+
+template<typename V, typename W, typename Queue>
+std::vector<W> fastbc::brandes::ChainContractedBrandesBC<V, W, Queue>::computeBC(
+	const std::shared_ptr<const IGraph<V, W>> graph)
+{
+	contraction_t contraction = _contract(*graph);
+
+	SPDLOG_INFO("Contracted {} chains of {} vertices, {} core vertices left",
+		contraction.chainA.size(), contraction.inner.size(), contraction.coreVertices.size());
+
+	if (useBucketQueue<Queue>(EdgeWeights<V, W>(*contraction.core)))
+	{
+		return _brandes<queue::BucketQueue<V, W>>(contraction);
+	}
+
+	return _brandes<Queue>(contraction);
+}
+
+template<typename V, typename W, typename Queue>
+typename fastbc::brandes::ChainContractedBrandesBC<V, W, Queue>::contraction_t
+fastbc::brandes::ChainContractedBrandesBC<V, W, Queue>::_contract(const IGraph<V, W>& graph)
+{
+	size_t vertexCount = graph.vertices().size();
+	contraction_t contraction;
+
+	// Contracted edges sum chain weights in advance: with fractional weights rounding could
+	// break ties with equal paths whose length is summed edge by edge, and lose shortest paths
+	bool integral = EdgeWeights<V, W>(graph).integral();
+	if (!integral)
+	{
+		SPDLOG_INFO("Fractional edge weights, chains are not contracted");
+	}
+
+	// Vertices with two neighbours, linked to each of them in both directions with the same weight
+	std::vector<bool> candidate(vertexCount, false);
+	for (size_t v = 0; integral && v < vertexCount; ++v)
+	{
+		const auto fs = graph.forwardStar(v);
+		const auto bs = graph.backwardStar(v);
+		if (fs.size() != 2 || bs.size() != 2 || fs.vertex(0) == (V)v || fs.vertex(1) == (V)v)
+		{
+			continue;
+		}
+
+		auto in0 = bs.find(fs.vertex(0));
+		auto in1 = bs.find(fs.vertex(1));
+		candidate[v] = in0 != bs.end() && in1 != bs.end() &&
+			in0->second == fs.weight(0) && in1->second == fs.weight(1);
+	}
+
+	// Neighbour of chain vertex v other than given one
+	auto next = [&graph](V v, V other)
+	{
+		const auto fs = graph.forwardStar(v);
+		return fs.vertex(0) == other ? fs.vertex(1) : fs.vertex(0);
+	};
+
+	contraction.innerEntry.assign(vertexCount, none);
+	contraction.chainBegin.push_back(0);
+
+	std::vector<bool> visited(vertexCount, false);
+	std::set<std::pair<V, V>> chainEndpoints;
+	std::vector<V> chain;
+	std::vector<W> chainWeights;
+	for (size_t x = 0; x < vertexCount; ++x)
+	{
+		if (!candidate[x] || visited[x])
+		{
+			continue;
+		}
+
+		// Walk back to chain endpoint, cycles of chain vertices are left in core graph
+		V prev = x;
+		V cur = graph.forwardStar(x).vertex(0);
+		visited[x] = true;
+		while (candidate[cur] && cur != (V)x)
+		{
+			visited[cur] = true;
+			V following = next(cur, prev);
+			prev = cur;
+			cur = following;
+		}
+		if (cur == (V)x)
+		{
+			continue;
+		}
+
+		// Collect chain inner vertices and edge weights from endpoint a to endpoint b
+		V a = cur;
+		chain.clear();
+		chainWeights.clear();
+		cur = prev;
+		prev = a;
+		while (candidate[cur])
+		{
+			visited[cur] = true;
+			chain.push_back(cur);
+			chainWeights.push_back(graph.forwardStar(prev).find(cur)->second);
+
+			V following = next(cur, prev);
+			prev = cur;
+			cur = following;
+		}
+		V b = cur;
+		chainWeights.push_back(graph.forwardStar(prev).find(b)->second);
+
+		// Contracted chain edges must not be parallel to other edges
+		if (a == b || graph.forwardStar(a).find(b) != graph.forwardStar(a).end() ||
+			graph.forwardStar(b).find(a) != graph.forwardStar(b).end() ||
+			!chainEndpoints.emplace(std::min(a, b), std::max(a, b)).second)
+		{
+			continue;
+		}
+
+		size_t chainIndex = contraction.chainA.size();
+		size_t begin = contraction.inner.size();
+		contraction.chainA.push_back(a);
+		contraction.chainB.push_back(b);
+		contraction.chainBegin.push_back(begin + chain.size());
+		contraction.inner.insert(contraction.inner.end(), chain.begin(), chain.end());
+		contraction.innerChain.insert(contraction.innerChain.end(), chain.size(), chainIndex);
+		contraction.fromA.resize(contraction.inner.size());
+		contraction.fromB.resize(contraction.inner.size());
+
+		W length = 0;
+		for (size_t i = 0; i < chain.size(); ++i)
+		{
+			length += chainWeights[i];
+			contraction.fromA[begin + i] = length;
+			contraction.innerEntry[chain[i]] = begin + i;
+		}
+		length = 0;
+		for (size_t i = chain.size(); i-- > 0;)
+		{
+			length += chainWeights[i + 1];
+			contraction.fromB[begin + i] = length;
+		}
+	}
+
+	// Renumber core vertices
+	contraction.rank.assign(vertexCount, 0);
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		if (contraction.innerEntry[v] == none)
+		{
+			contraction.rank[v] = contraction.coreVertices.size();
+			contraction.coreVertices.push_back(v);
+		}
+	}
+	for (size_t c = 0; c < contraction.chainA.size(); ++c)
+	{
+		contraction.chainA[c] = contraction.rank[contraction.chainA[c]];
+		contraction.chainB[c] = contraction.rank[contraction.chainB[c]];
+	}
+
+	// Keep edges among core vertices, and add an edge per chain direction
+	std::vector<V> src;
+	std::vector<V> dest;
+	std::vector<W> weight;
+	for (V v : contraction.coreVertices)
+	{
+		const auto fs = graph.forwardStar(v);
+		for (size_t i = 0; i < fs.size(); ++i)
+		{
+			if (contraction.innerEntry[fs.vertex(i)] == none)
+			{
+				src.push_back(contraction.rank[v]);
+				dest.push_back(contraction.rank[fs.vertex(i)]);
+				weight.push_back(fs.weight(i));
+			}
+		}
+	}
+	for (size_t c = 0; c < contraction.chainA.size(); ++c)
+	{
+		size_t first = contraction.chainBegin[c];
+		size_t last = contraction.chainBegin[c + 1] - 1;
+		W lastWeight = graph.forwardStar(contraction.inner[last]).find(
+			contraction.coreVertices[contraction.chainB[c]])->second;
+		W firstWeight = graph.forwardStar(contraction.inner[first]).find(
+			contraction.coreVertices[contraction.chainA[c]])->second;
+
+		src.insert(src.end(), { contraction.chainA[c], contraction.chainB[c] });
+		dest.insert(dest.end(), { contraction.chainB[c], contraction.chainA[c] });
+		weight.insert(weight.end(), { contraction.fromA[last] + lastWeight, contraction.fromB[first] + firstWeight });
+	}
+
+	contraction.core = std::make_shared<CSRGraph<V, W>>(std::move(src), std::move(dest), std::move(weight));
+
+	// Mark chain edges of core graph
+	size_t coreSize = contraction.core->vertices().size();
+	contraction.edgeOffset.assign(coreSize + 1, 0);
+	for (size_t v = 0; v < coreSize; ++v)
+	{
+		contraction.edgeOffset[v + 1] = contraction.edgeOffset[v] + contraction.core->forwardStar(v).size();
+	}
+	contraction.edgeChain.assign(contraction.edgeOffset.back(), none);
+	for (size_t c = 0; c < contraction.chainA.size(); ++c)
+	{
+		for (const auto& [from, to] : { std::make_pair(contraction.chainA[c], contraction.chainB[c]),
+			std::make_pair(contraction.chainB[c], contraction.chainA[c]) })
+		{
+			const auto fs = contraction.core->forwardStar(from);
+			for (size_t i = 0; i < fs.size(); ++i)
+			{
+				if (fs.vertex(i) == to)
+				{
+					contraction.edgeChain[contraction.edgeOffset[from] + i] = c;
+				}
+			}
+		}
+	}
+
+	return contraction;
+}
+
+template<typename V, typename W, typename Queue>
+template<typename Q>
+std::vector<W> fastbc::brandes::ChainContractedBrandesBC<V, W, Queue>::_brandes(
+	const contraction_t& contraction)
+{
+	const auto& core = contraction.core;
+	const auto& chainA = contraction.chainA;
+	const auto& chainB = contraction.chainB;
+	const auto& chainBegin = contraction.chainBegin;
+	const auto& inner = contraction.inner;
+	const auto& fromA = contraction.fromA;
+	const auto& fromB = contraction.fromB;
+
+	size_t vertexCount = contraction.rank.size();
+	size_t coreCount = contraction.coreVertices.size();
+	size_t coreSize = core->vertices().size();
+	size_t chainCount = chainA.size();
+
+	// Each thread sums BC by original vertex index, and flow through each chain, to its own buffers
+	ParallelAccumulator<W> bcAccumulator(vertexCount);
+	ParallelAccumulator<W> throughAccumulator(chainCount);
+
+	#pragma omp parallel
+	{
+		W* _bc = bcAccumulator.local();
+		W* _through = throughAccumulator.local();
+
+		SSSPWorkspace<V, W, Q>& workspace = SSSPWorkspace<V, W, Q>::local();
+		const auto& visitStack = workspace.visitStack;
+		auto& dist = workspace.dist;
+		auto& sigma = workspace.sigma;
+		auto& delta = workspace.delta;
+
+		// Fraction of paths to each chain inner vertex entering from each endpoint, or along source chain
+		std::vector<W> viaA(inner.size());
+		std::vector<W> viaB(inner.size());
+		std::vector<W> direct(inner.size());
+
+		#pragma omp for schedule(dynamic, 1)
+		for (size_t s = 0; s < vertexCount; ++s)
+		{
+			workspace.prepare(coreCount);
+
+			// Inner sources reach the core graph through both endpoints of their chain
+			size_t sourceEntry = contraction.innerEntry[s];
+			size_t sourceChain = sourceEntry != none ? contraction.innerChain[sourceEntry] : none;
+			V sourceRank = contraction.rank[s];
+			if (sourceEntry == none)
+			{
+				dist[sourceRank] = 0;
+				sigma[sourceRank] = 1;
+				workspace.visitQueue.push(sourceRank, 0);
+			}
+			else
+			{
+				for (const auto& [seed, seedDist] : { std::make_pair(chainA[sourceChain], fromA[sourceEntry]),
+					std::make_pair(chainB[sourceChain], fromB[sourceEntry]) })
+				{
+					dist[seed] = seedDist;
+					sigma[seed] = 1;
+					workspace.visitQueue.push(seed, seedDist);
+				}
+			}
+
+			_dijkstra_SSSP(contraction, sourceChain, workspace);
+
+			// Chain inner targets are reached from chain endpoints, or along source chain
+			for (size_t c = 0; c < chainCount; ++c)
+			{
+				V a = chainA[c];
+				V b = chainB[c];
+				bool onChain = c == sourceChain;
+				if (!onChain && dist[a] == std::numeric_limits<W>::max() && dist[b] == std::numeric_limits<W>::max())
+				{
+					continue;
+				}
+
+				W toA = 0;
+				W toB = 0;
+				for (size_t t = chainBegin[c]; t < chainBegin[c + 1]; ++t)
+				{
+					viaA[t] = viaB[t] = direct[t] = 0;
+					if (t == sourceEntry)
+					{
+						continue;
+					}
+
+					W distA = dist[a] != std::numeric_limits<W>::max() ? dist[a] + fromA[t] : dist[a];
+					W distB = dist[b] != std::numeric_limits<W>::max() ? dist[b] + fromB[t] : dist[b];
+					W distDirect = !onChain ? std::numeric_limits<W>::max() :
+						t > sourceEntry ? fromA[t] - fromA[sourceEntry] : fromB[t] - fromB[sourceEntry];
+
+					W tDist = std::min(distDirect, std::min(distA, distB));
+					if (tDist == std::numeric_limits<W>::max())
+					{
+						continue;
+					}
+
+					W tSigma = (distA == tDist ? sigma[a] : 0) + (distB == tDist ? sigma[b] : 0) +
+						(distDirect == tDist ? 1 : 0);
+					viaA[t] = distA == tDist ? sigma[a] / tSigma : 0;
+					viaB[t] = distB == tDist ? sigma[b] / tSigma : 0;
+					direct[t] = distDirect == tDist ? 1 / tSigma : 0;
+
+					toA += viaA[t];
+					toB += viaB[t];
+				}
+
+				// Chain targets are leaves of the shortest paths DAG
+				delta[a] += toA;
+				delta[b] += toB;
+
+				// Inner vertices lie on paths to the targets after them from endpoint a,
+				// before them from endpoint b, and between them and an inner source
+				W beyond = 0;
+				W beyondDirect = 0;
+				for (size_t i = chainBegin[c + 1]; i-- > chainBegin[c];)
+				{
+					bool afterSource = onChain && i > sourceEntry;
+					_bc[inner[i]] += beyond + (afterSource ? beyondDirect : 0);
+					beyond += viaA[i];
+					beyondDirect += afterSource ? direct[i] : 0;
+				}
+				beyond = 0;
+				beyondDirect = 0;
+				for (size_t i = chainBegin[c]; i < chainBegin[c + 1]; ++i)
+				{
+					bool beforeSource = onChain && i < sourceEntry;
+					_bc[inner[i]] += beyond + (beforeSource ? beyondDirect : 0);
+					beyond += viaB[i];
+					beyondDirect += beforeSource ? direct[i] : 0;
+				}
+			}
+
+			// Backward visit of each vertex, pulling dependency from its successors
+			for (auto it = visitStack.rbegin(); it != visitStack.rend(); ++it)
+			{
+				V v = *it;
+
+				if ((size_t)v < coreSize)
+				{
+					const auto fs = core->forwardStar(v);
+					const V* fsVertices = fs.vertices();
+					const W* fsWeights = fs.weights();
+					const size_t* fsChains = contraction.edgeChain.data() + contraction.edgeOffset[v];
+					for (size_t i = 0; i < fs.size(); ++i)
+					{
+						V w = fsVertices[i];
+						if (dist[v] + fsWeights[i] == dist[w] && (sourceChain == none || fsChains[i] != sourceChain))
+						{
+							W c = sigma[v] / sigma[w] * (1.0 + delta[w]);
+							delta[v] += c;
+
+							// Every inner vertex of a chain lies on the paths along its edge
+							if (fsChains[i] != none)
+							{
+								_through[fsChains[i]] += c;
+							}
+						}
+					}
+				}
+
+				if (sourceEntry != none || v != sourceRank)
+				{
+					_bc[contraction.coreVertices[v]] += delta[v];
+				}
+			}
+
+			// Source chain vertices lie on the paths leaving it through the endpoint they precede
+			if (sourceEntry != none)
+			{
+				V a = chainA[sourceChain];
+				V b = chainB[sourceChain];
+				W leavingA = dist[a] == fromA[sourceEntry] ? (1.0 + delta[a]) / sigma[a] : 0;
+				W leavingB = dist[b] == fromB[sourceEntry] ? (1.0 + delta[b]) / sigma[b] : 0;
+
+				for (size_t i = chainBegin[sourceChain]; i < chainBegin[sourceChain + 1]; ++i)
+				{
+					if (i != sourceEntry)
+					{
+						_bc[inner[i]] += i < sourceEntry ? leavingA : leavingB;
+					}
+				}
+			}
+
+			workspace.release();
+		}
+	}
+
+	std::vector<W> bc(vertexCount, (W)0);
+	std::vector<W> through(chainCount, (W)0);
+	bcAccumulator.mergeInto(bc.data());
+	throughAccumulator.mergeInto(through.data());
+
+	for (size_t c = 0; c < chainCount; ++c)
+	{
+		for (size_t i = chainBegin[c]; i < chainBegin[c + 1]; ++i)
+		{
+			bc[inner[i]] += through[c];
+		}
+	}
+
+	return bc;
+}
+
+template<typename V, typename W, typename Queue>
+template<typename Q>
+void fastbc::brandes::ChainContractedBrandesBC<V, W, Queue>::_dijkstra_SSSP(
+	const contraction_t& contraction,
+	size_t skipChain,
+	SSSPWorkspace<V, W, Q>& workspace)
+{
+	const auto& core = contraction.core;
+	size_t coreSize = core->vertices().size();
+
+	auto& visitStack = workspace.visitStack;
+	auto& dist = workspace.dist;
+	auto& sigma = workspace.sigma;
+	auto& visitQueue = workspace.visitQueue;
+
+	// Sources are already queued
+	while (!visitQueue.empty())
+	{
+		V v = visitQueue.pop();
+		visitStack.push_back(v);
+
+		// Trailing isolated core vertices are not part of the core graph
+		if ((size_t)v >= coreSize)
+		{
+			continue;
+		}
+
+		const auto fs = core->forwardStar(v);
+		const V* fsVertices = fs.vertices();
+		const W* fsWeights = fs.weights();
+		const size_t* fsChains = contraction.edgeChain.data() + contraction.edgeOffset[v];
+		for (size_t i = 0; i < fs.size(); ++i)
+		{
+			// Source chain is not walked past the source
+			if (skipChain != none && fsChains[i] == skipChain)
+			{
+				continue;
+			}
+
+			V w = fsVertices[i];
+			W newDist = dist[v] + fsWeights[i];
+
+			if (newDist < dist[w])
+			{
+				if (dist[w] == std::numeric_limits<W>::max())
+				{
+					visitQueue.push(w, newDist);
+				}
+				else
+				{
+					visitQueue.decrease(w, newDist);
+				}
+				dist[w] = newDist;
+				sigma[w] = 0;
+			}
+
+			if (newDist == dist[w])
+			{
+				sigma[w] += sigma[v];
+			}
+		}
+	}
+}
+
+#endif
@@ -1,22 +1,44 @@
 #ifndef FASTBC_BRANDES_CLUSTEREDBRANDESBC_H
 #define FASTBC_BRANDES_CLUSTEREDBRANDESBC_H
 
+#include "BFSClusterEvaluator.h"
+#include "BFSSSBrandesBC.h"
+#include "DijkstraClusterEvaluator.h"
+#include "DijkstraSSBrandesBC.h"
 #include "IBrandesBC.h"
 #include "IClusterEvaluator.h"
 #include "ISSBrandesBC.h"
 #include "IPivotSelector.h"
-#include "VertexInfo.h"
+#include "MultiSourceBFSBrandesBC.h"
+#include "ParallelAccumulator.h"
+#include "VertexInfoMatrix.h"
+#include <EdgeWeights.h>
 #include <IGraphPartition.h>
-#include <SubGraph.h>
+#include <LocalSubGraph.h>
+#include <queue/BucketQueue.h>
+#include <queue/DefaultQueue.h>
 
+#include <algorithm>
 #include <memory>
 #include <spdlog/spdlog.h>
 #include <vector>
 
+#include <omp.h>
+
+#ifndef FASTBC_BRANDES_CLUSTERED_BATCH_MEMORY
+// Memory allowed to the pivots batch visit buffers of all threads, in bytes
+#define FASTBC_BRANDES_CLUSTERED_BATCH_MEMORY (size_t(1) << 30)
+#endif
+
 namespace fastbc {
 	namespace brandes {
 
-		template<typename V, typename W>
+		/**
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for edge weight value
+		 *	@tparam Queue Priority queue policy of components selected for weighted graphs
+		 */
+		template<typename V, typename W, typename Queue = queue::DefaultQueue<V, W>>
 		class ClusteredBrandeBC : public IBrandesBC<V, W>
 		{
 		public:
@@ -25,11 +47,19 @@ namespace fastbc {
 			 * 
 			 * 	@details The object will perform a clustered Brandes' BC computation
 			 * 			 using given algorithm instances for clusters creation and
-			 * 			 evaluation and BC computation
+			 * 			 evaluation and BC computation. Cluster evaluator and single
+			 * 			 source computer not given are selected for each graph: breadth
+			 * 			 first search based ones when graph edges share the same weight,
+			 * 			 visiting pivots in batches (see MultiSourceBFSBrandesBC) as wide as
+			 * 			 FASTBC_BRANDES_CLUSTERED_BATCH_MEMORY allows, Dijkstra
+			 * 			 based ones with a bucket queue when they have small integer
+			 * 			 weights, with Queue policy else. Given instances are always used.
+			 * 			 Intra-cluster correction is skipped with evaluators computing
+			 * 			 vertices information only.
 			 * 
 			 * 	@param gp Graph partition creator
-			 * 	@param ce Cluster BC evaluator
-			 * 	@param ssb Single source Brandes' BC computer
+			 * 	@param ce Cluster BC evaluator, selected for each graph if null
+			 * 	@param ssb Single source Brandes' BC computer, selected for each graph if null
 			 * 	@param ps Pivot selector to use on computed clusters
 			 */
 			ClusteredBrandeBC(
@@ -50,8 +80,8 @@ namespace fastbc {
 	}
 }
 
-template<typename V, typename W>
-fastbc::brandes::ClusteredBrandeBC<V, W>::ClusteredBrandeBC(
+template<typename V, typename W, typename Queue>
+fastbc::brandes::ClusteredBrandeBC<V, W, Queue>::ClusteredBrandeBC(
 	std::shared_ptr<fastbc::IGraphPartition<V, W>> gp,
 	std::shared_ptr<fastbc::brandes::IClusterEvaluator<V, W>> ce,
 	std::shared_ptr<fastbc::brandes::ISSBrandesBC<V, W>> ssb,
@@ -60,22 +90,76 @@ fastbc::brandes::ClusteredBrandeBC<V, W>::ClusteredBrandeBC(
 {
 }
 
-template<typename V, typename W>
-std::vector<W> fastbc::brandes::ClusteredBrandeBC<V, W>::computeBC(
+template<typename V, typename W, typename Queue>
+std::vector<W> fastbc::brandes::ClusteredBrandeBC<V, W, Queue>::computeBC(
 	const std::shared_ptr<const fastbc::IGraph<V, W>> graph)
 {
 	// Global betweenness centrality storage
 	std::vector<W> globalBC(graph->vertices().size(), (W)0);
 
-	// Vertices topological information about their own cluster border vertices
-	std::vector<std::shared_ptr<VertexInfo<V, W>>> verticesInfo(graph->vertices().size(), nullptr);
-
 	// Computed subgraph and border vertices from each vertices community
 	std::vector<std::shared_ptr<ISubGraph<V, W>>> cluster;
 
 	// Pivot vertices and related class cardinality for each cluster
 	std::vector<std::pair<std::vector<V>, std::vector<V>>> pivotsCluster;
 
+	// Components not given are selected from edge weights: uniform edge weights do not need
+	// a priority queue, use breadth first search instead, while small integer edge weights
+	// bound distances spread enabling a bucket queue
+	std::shared_ptr<IClusterEvaluator<V, W>> ce = _ce;
+	std::shared_ptr<ISSBrandesBC<V, W>> ssb = _ssb;
+	std::shared_ptr<MultiSourceBFSBrandesBC<V, W>> msb;
+	if (!ce || !ssb)
+	{
+		EdgeWeights<V, W> weights(*graph);
+		if (weights.uniform())
+		{
+			SPDLOG_INFO("Uniform edge weights, computing shortest paths by breadth first search");
+			if (!ce)
+			{
+				ce = std::make_shared<BFSClusterEvaluator<V, W>>();
+			}
+			if (!ssb)
+			{
+				// Batch visit buffers of each thread grow with graph size, narrow batches
+				// are not worth them
+				size_t lanes = MultiSourceBFSBrandesBC<V, W>::fittingLanes(
+					graph->vertices().size(), omp_get_max_threads(), FASTBC_BRANDES_CLUSTERED_BATCH_MEMORY);
+				if (lanes >= 8)
+				{
+					SPDLOG_INFO("Visiting pivots in batches of {}", lanes);
+					msb = std::make_shared<MultiSourceBFSBrandesBC<V, W>>(lanes);
+				}
+				else
+				{
+					ssb = std::make_shared<BFSSSBrandesBC<V, W>>();
+				}
+			}
+		}
+		else if (useBucketQueue<Queue>(weights))
+		{
+			if (!ce)
+			{
+				ce = std::make_shared<DijkstraClusterEvaluator<V, W, queue::BucketQueue<V, W>>>();
+			}
+			if (!ssb)
+			{
+				ssb = std::make_shared<DijkstraSSBrandesBC<V, W, queue::BucketQueue<V, W>>>();
+			}
+		}
+		else
+		{
+			if (!ce)
+			{
+				ce = std::make_shared<DijkstraClusterEvaluator<V, W, Queue>>();
+			}
+			if (!ssb)
+			{
+				ssb = std::make_shared<DijkstraSSBrandesBC<V, W, Queue>>();
+			}
+		}
+	}
+
 	// Compute graph partition using Louvain communities detection algorithm
 	SPDLOG_INFO("Computing clusters with Louvain algorithm...");
 	std::vector<std::vector<V>> communities = 
@@ -87,37 +171,66 @@ std::vector<W> fastbc::brandes::ClusteredBrandeBC<V, W>::computeBC(
 
 	// For each detected community compute related sub-graph, evaluate it for internal BC
 	// and perform topological analysis to get pivots and vertices class cardinality
-	SPDLOG_INFO("Evaluating intra cluster BC...");
+	if (ce->computesClusterBC())
+	{
+		SPDLOG_INFO("Evaluating intra cluster BC...");
+	}
+	else
+	{
+		SPDLOG_INFO("Evaluating clusters vertices information, skipping intra cluster BC...");
+	}
 	#pragma omp parallel for
 	for (int i = 0; i < cluster.size(); i++)
 	{
-		cluster[i] = std::make_shared<SubGraph<V, W>>(communities[i], graph);
+		cluster[i] = std::make_shared<LocalSubGraph<V, W>>(communities[i], graph);
+	}
 
-		SPDLOG_DEBUG("Evaluating BC on cluster {}: {} vertices ({} borders), {} edges", 
-			i, cluster[i]->vertices().size(), cluster[i]->borders().size(), cluster[i]->edges());
-		
-#ifndef FASTBC_BRANDES_CLUSTERED_IGNORE_UNCONNECTED
-		if (cluster[i]->borders().empty())
+	// Clusters are evaluated by decreasing cost, estimated as vertices times edges, so
+	// that giant clusters start first and their source tasks are shared by idle threads
+	std::vector<size_t> cost(cluster.size());
+	std::vector<size_t> order(cluster.size());
+	for (size_t i = 0; i < cluster.size(); i++)
+	{
+		cost[i] = cluster[i]->vertices().size() * cluster[i]->edges();
+		order[i] = i;
+	}
+	std::stable_sort(order.begin(), order.end(), [&cost](size_t a, size_t b) { return cost[a] > cost[b]; });
+
+	#pragma omp parallel
+	#pragma omp single
+	for (size_t i : order)
+	{
+		#pragma omp task firstprivate(i)
 		{
-			SPDLOG_WARN("Cluster {} ({} vertices, {} edges) is disconnected from the rest of the graph.", 
-				i, cluster[i]->vertices().size(), cluster[i]->edges());
-		}
+			SPDLOG_DEBUG("Evaluating BC on cluster {}: {} vertices ({} borders), {} edges", 
+				i, cluster[i]->vertices().size(), cluster[i]->borders().size(), cluster[i]->edges());
+			
+#ifndef FASTBC_BRANDES_CLUSTERED_IGNORE_UNCONNECTED
+			if (cluster[i]->borders().empty())
+			{
+				SPDLOG_WARN("Cluster {} ({} vertices, {} edges) is disconnected from the rest of the graph.", 
+					i, cluster[i]->vertices().size(), cluster[i]->edges());
+			}
 #else
-		if (!cluster[i]->borders().empty())
-		{
+			if (!cluster[i]->borders().empty())
+			{
 #endif
-		
-		_ce->evaluateCluster(globalBC, verticesInfo, cluster[i]);
+			
+			// Vertices topological information about their own cluster border vertices,
+			// only needed for pivot selection
+			VertexInfoMatrix<V, W> clusterInfo;
+			ce->evaluateCluster(globalBC, clusterInfo, cluster[i]);
 
-		pivotsCluster[i] = _ps->selectPivots(
-			globalBC, verticesInfo, 
-			cluster[i]->vertices(), cluster[i]->borders());
+			pivotsCluster[i] = _ps->selectPivots(
+				globalBC, clusterInfo, 
+				cluster[i]->vertices(), cluster[i]->borders());
 
-		SPDLOG_DEBUG("Selected {} vertices as pivots in cluster {}", pivotsCluster[i].first.size(), i);
-		
+			SPDLOG_DEBUG("Selected {} vertices as pivots in cluster {}", pivotsCluster[i].first.size(), i);
+			
 #ifdef FASTBC_BRANDES_CLUSTERED_IGNORE_UNCONNECTED
-		}
+			}
 #endif
+		}
 	}
 
 	// Store computed intra-cluster BC for corrections on 
@@ -135,33 +248,83 @@ std::vector<W> fastbc::brandes::ClusteredBrandeBC<V, W>::computeBC(
 	SPDLOG_INFO("Computing global BC from {} pivots...", pivotCount);
 #endif
 
-	// Compute global dependecy contribution for each selected pivot
-	W* _globalBC = globalBC.data();
-	size_t _globalBCsize = globalBC.size();
+	// Flatten pivots of all clusters in a single task list, so that clusters with
+	// few pivots do not leave threads idle
+	std::vector<std::pair<size_t, size_t>> pivotTasks;
 	for (size_t c = 0; c < cluster.size(); ++c)
 	{
-		#pragma omp parallel for reduction(+:_globalBC[:_globalBCsize])
 		for (size_t p = 0; p < pivotsCluster[c].first.size(); ++p)
 		{
-			SPDLOG_DEBUG("Computing SSSP from pivot vertex {}", pivotsCluster[c].first[p]);
-			std::vector<W> pivotDependency = 
-				_ssb->singleSourceBrandes(pivotsCluster[c].first[p], graph);
+			pivotTasks.emplace_back(c, p);
+		}
+	}
 
-			// Sum pivot dependecy to all vertices
-			#pragma omp simd
-			for(size_t v = 0; v < _globalBCsize; ++v)
-			{
-				_globalBC[v] += pivotDependency[v] * (W)(pivotsCluster[c].second[p]);
-			}
+	// Compute global dependecy contribution for each selected pivot, summed
+	// to per-thread buffers merged once at the end
+	ParallelAccumulator<W> accumulator(globalBC.size());
+	if (msb)
+	{
+		// Consecutive pivots, mostly from the same cluster, are visited together
+		size_t batchCount = (pivotTasks.size() + msb->lanes() - 1) / msb->lanes();
 
-			// Subtract duplicate dependency from current pivot's cluster vertices
-			#pragma omp simd
-			for (size_t vIndex = 0; vIndex < cluster[c]->vertices().size(); ++vIndex)
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (size_t b = 0; b < batchCount; ++b)
+		{
+			std::vector<V> sources;
+			std::vector<W> scales;
+			for (size_t t = b * msb->lanes(); t < std::min((b + 1) * msb->lanes(), pivotTasks.size()); ++t)
 			{
-				const V& v = cluster[c]->vertices()[vIndex];
+				const auto& [c, p] = pivotTasks[t];
 
-				_globalBC[v] -= intraClusterBC[v] * (W)(pivotsCluster[c].second[p]);
+				sources.push_back(pivotsCluster[c].first[p]);
+				scales.push_back((W)(pivotsCluster[c].second[p]));
 			}
+
+			SPDLOG_DEBUG("Computing SSSP from batch of {} pivot vertices", sources.size());
+
+			// Sum pivots dependecy to vertices reached from each pivot
+			msb->accumulateBrandes(sources, graph, scales, accumulator.local());
+		}
+	}
+	else
+	{
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (size_t t = 0; t < pivotTasks.size(); ++t)
+		{
+			const auto& [c, p] = pivotTasks[t];
+
+			SPDLOG_DEBUG("Computing SSSP from pivot vertex {}", pivotsCluster[c].first[p]);
+
+			// Sum pivot dependecy to vertices reached from pivot
+			ssb->accumulateBrandes(pivotsCluster[c].first[p], graph,
+				(W)(pivotsCluster[c].second[p]), accumulator.local());
+		}
+	}
+	accumulator.mergeInto(globalBC.data());
+
+	// Without intra-cluster BC there is no duplicate dependency to subtract
+	if (!ce->computesClusterBC())
+	{
+		return globalBC;
+	}
+
+	// Subtract duplicate dependency from each pivot's cluster vertices, once per
+	// cluster for all of its pivots classes
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (size_t c = 0; c < cluster.size(); ++c)
+	{
+		W clusterCardinality = 0;
+		for (const auto& cardinality : pivotsCluster[c].second)
+		{
+			clusterCardinality += (W)cardinality;
+		}
+
+		#pragma omp simd
+		for (size_t vIndex = 0; vIndex < cluster[c]->vertices().size(); ++vIndex)
+		{
+			const V& v = cluster[c]->vertices()[vIndex];
+
+			globalBC[v] -= intraClusterBC[v] * clusterCardinality;
 		}
 	}
 
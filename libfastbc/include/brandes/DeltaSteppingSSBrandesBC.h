@@ -0,0 +1,405 @@
+#ifndef FASTBC_BRANDES_DELTASTEPPINGSSBRANDESBC_H
+#define FASTBC_BRANDES_DELTASTEPPINGSSBRANDESBC_H
+
+#include "ISSBrandesBC.h"
+#include "SSSPWorkspace.h"
+#include <EdgeWeights.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <omp.h>
+
+namespace fastbc {
+	namespace brandes {
+
+		/**
+		 *	@brief Single source Brandes' dependency computation parallelized within the source
+		 *
+		 *	@details Distances are computed by delta-stepping: vertices are kept in buckets
+		 *			 of distance width delta, and each bucket is settled by relaxing in
+		 *			 parallel the light edges (not heavier than delta) of its vertices until
+		 *			 no vertex enters it again, then their heavy edges once.
+		 *			 Reached vertices sorted by distance are split in levels narrower than the
+		 *			 minimum edge weight, so that no shortest path edge joins vertices of the
+		 *			 same level. Shortest paths counts are then pulled from predecessors level
+		 *			 by level, and dependencies from successors in reverse level order, in
+		 *			 parallel within each level and without atomic updates.
+		 *			 Use it when sources are fewer than threads, otherwise parallelizing
+		 *			 across sources (see ExactBrandesBC) is more efficient.
+		 *
+		 *	@note Edge weights must be greater than zero
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for edge weight value
+		 */
+		template<typename V, typename W>
+		class DeltaSteppingSSBrandesBC : public ISSBrandesBC<V, W>
+		{
+		public:
+			/**
+			 *	@brief Initialize a delta-stepping single source Brandes computer
+			 *
+			 *	@details Edge weights are scanned once per graph, and kept until a different
+			 *			 graph is given.
+			 *
+			 *	@param delta Buckets width, if not positive it is chosen for each graph as
+			 *				 maximum edge weight divided by average out degree
+			 */
+			DeltaSteppingSSBrandesBC(W delta = 0);
+
+			std::vector<W> singleSourceBrandes(
+				V source,
+				std::shared_ptr<const IGraph<V, W>> graph) override;
+
+			void accumulateBrandes(
+				V source,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				W scale,
+				W* bc) override;
+
+			W accumulateWeightedBrandes(
+				V source,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				const std::vector<W>& vertexWeights,
+				W scale,
+				W* bc,
+				W* reached) override;
+
+		private:
+			const W _delta;
+
+			/* Last graph given, its minimum edge weight and buckets width */
+			std::weak_ptr<const IGraph<V, W>> _graph;
+			W _minWeight;
+			W _bucketWidth;
+
+			void _graphParameters(
+				std::shared_ptr<const IGraph<V, W>> graph,
+				W& minWeight,
+				W& bucketWidth);
+
+			W _accumulate(
+				V source,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				const W* vertexWeights,
+				W scale,
+				W* bc,
+				W* reached);
+
+			void _deltaStepping(
+				V src,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				W bucketWidth,
+				SSSPWorkspace<V, W>& workspace);
+
+			static bool _atomicMin(W& target, W value);
+		};
+
+	}
+}
+
+template<typename V, typename W>
+fastbc::brandes::DeltaSteppingSSBrandesBC<V, W>::DeltaSteppingSSBrandesBC(W delta)
+	: _delta(delta), _minWeight(0), _bucketWidth(0)
+{
+}
+
+template<typename V, typename W>
+std::vector<W> fastbc::brandes::DeltaSteppingSSBrandesBC<V, W>::singleSourceBrandes(
+	V source,
+	std::shared_ptr<const IGraph<V, W>> graph)
+{
+	std::vector<W> ssBC(graph->vertices().size(), (W)0);
+
+	accumulateBrandes(source, graph, 1, ssBC.data());
+
+	return ssBC;
+}
+
+template<typename V, typename W>
+void fastbc::brandes::DeltaSteppingSSBrandesBC<V, W>::accumulateBrandes(
+	V source,
+	std::shared_ptr<const IGraph<V, W>> graph,
+	W scale,
+	W* bc)
+{
+	_accumulate(source, graph, nullptr, scale, bc, nullptr);
+}
+
+template<typename V, typename W>
+W fastbc::brandes::DeltaSteppingSSBrandesBC<V, W>::accumulateWeightedBrandes(
+	V source,
+	std::shared_ptr<const IGraph<V, W>> graph,
+	const std::vector<W>& vertexWeights,
+	W scale,
+	W* bc,
+	W* reached)
+{
+	return _accumulate(source, graph, vertexWeights.data(), scale, bc, reached);
+}
+
+template<typename V, typename W>
+void fastbc::brandes::DeltaSteppingSSBrandesBC<V, W>::_graphParameters(
+	std::shared_ptr<const IGraph<V, W>> graph,
+	W& minWeight,
+	W& bucketWidth)
+{
+	#pragma omp critical(fastbc_brandes_deltastepping_graph)
+	{
+		// Edge weights are scanned again only when graph changes
+		if (_graph.lock() != graph)
+		{
+			EdgeWeights<V, W> weights(*graph);
+
+			_minWeight = weights.min();
+			_bucketWidth = _delta;
+			if (_bucketWidth <= 0)
+			{
+				_bucketWidth = graph->edges() > 0 ?
+					std::max(weights.min(), weights.max() * graph->vertices().size() / graph->edges()) : 1;
+			}
+			_graph = graph;
+		}
+
+		minWeight = _minWeight;
+		bucketWidth = _bucketWidth;
+	}
+}
+
+template<typename V, typename W>
+W fastbc::brandes::DeltaSteppingSSBrandesBC<V, W>::_accumulate(
+	V source,
+	std::shared_ptr<const IGraph<V, W>> graph,
+	const W* vertexWeights,
+	W scale,
+	W* bc,
+	W* reached)
+{
+	W minWeight, bucketWidth;
+	_graphParameters(graph, minWeight, bucketWidth);
+
+	// Buffers of calling thread are shared by all threads working on this source
+	SSSPWorkspace<V, W>& workspace = SSSPWorkspace<V, W>::local();
+	workspace.prepare(graph->vertices().size());
+
+	// Reached vertices are stored in visit stack by non-decreasing distance
+	_deltaStepping(source, graph, bucketWidth, workspace);
+	const auto& visitStack = workspace.visitStack;
+	const auto& dist = workspace.dist;
+	auto& sigma = workspace.sigma;
+	auto& delta = workspace.delta;
+
+	// Split reached vertices in levels with no shortest path edge inside
+	std::vector<size_t> levels(1, 0);
+	for (size_t i = 1; i < visitStack.size(); ++i)
+	{
+		if (dist[visitStack[i]] >= dist[visitStack[levels.back()]] + minWeight)
+		{
+			levels.push_back(i);
+		}
+	}
+	levels.push_back(visitStack.size());
+
+	sigma[source] = 1;
+
+	// Without vertex weights each vertex stands for itself only
+	W sourceWeight = vertexWeights ? vertexWeights[source] : 1;
+
+	#pragma omp parallel
+	{
+		// Pull shortest paths count from predecessors, source is the only vertex of first level
+		for (size_t l = 1; l + 1 < levels.size(); ++l)
+		{
+			#pragma omp for schedule(dynamic, 64)
+			for (size_t i = levels[l]; i < levels[l + 1]; ++i)
+			{
+				V w = visitStack[i];
+
+				const auto bs = graph->backwardStar(w);
+				const V* bsVertices = bs.vertices();
+				const W* bsWeights = bs.weights();
+				W count = 0;
+				for (size_t e = 0; e < bs.size(); ++e)
+				{
+					V v = bsVertices[e];
+					if (dist[v] != std::numeric_limits<W>::max() && dist[v] + bsWeights[e] == dist[w])
+					{
+						count += sigma[v];
+					}
+				}
+				sigma[w] = count;
+			}
+		}
+
+		// Pull dependency from successors, in reverse levels order
+		for (size_t l = levels.size() - 1; l-- > 0;)
+		{
+			#pragma omp for schedule(dynamic, 64)
+			for (size_t i = levels[l]; i < levels[l + 1]; ++i)
+			{
+				V v = visitStack[i];
+
+				const auto fs = graph->forwardStar(v);
+				const V* fsVertices = fs.vertices();
+				const W* fsWeights = fs.weights();
+				W dependency = 0;
+				for (size_t e = 0; e < fs.size(); ++e)
+				{
+					V w = fsVertices[e];
+					if (dist[v] + fsWeights[e] == dist[w])
+					{
+						W weight = vertexWeights ? vertexWeights[w] : 1;
+						dependency += sigma[v] / sigma[w] * (weight + delta[w]);
+					}
+				}
+				delta[v] = dependency;
+
+				if (v != source)
+				{
+					// Vertices of v group other than v are reached through it
+					W weight = vertexWeights ? vertexWeights[v] : 1;
+					bc[v] += (dependency + (weight - 1)) * sourceWeight * scale;
+
+					if (reached)
+					{
+						reached[v] += sourceWeight * scale;
+					}
+				}
+			}
+		}
+	}
+
+	// Source is inner vertex of the paths from the other vertices of its group
+	W reach = delta[source];
+	if (sourceWeight != 1)
+	{
+		bc[source] += (sourceWeight - 1) * reach * scale;
+	}
+
+	workspace.release();
+
+	return reach;
+}
+
+template<typename V, typename W>
+void fastbc::brandes::DeltaSteppingSSBrandesBC<V, W>::_deltaStepping(
+	V src,
+	std::shared_ptr<const IGraph<V, W>> graph,
+	W bucketWidth,
+	SSSPWorkspace<V, W>& workspace)
+{
+	auto& visitStack = workspace.visitStack;
+	auto& dist = workspace.dist;
+
+	// Vertices entered in each bucket, possibly repeated or outdated
+	std::vector<std::vector<V>> buckets(1);
+
+	// Vertices entering a bucket found by each thread, merged after each relaxation
+	std::vector<std::vector<std::pair<size_t, V>>> requests(omp_get_max_threads());
+
+	auto relax = [&](const std::vector<V>& vertices, bool light)
+	{
+		#pragma omp parallel
+		{
+			auto& threadRequests = requests[omp_get_thread_num()];
+
+			#pragma omp for schedule(dynamic, 64)
+			for (size_t i = 0; i < vertices.size(); ++i)
+			{
+				V v = vertices[i];
+				W vDist;
+				__atomic_load(&dist[v], &vDist, __ATOMIC_RELAXED);
+
+				const auto fs = graph->forwardStar(v);
+				const V* fsVertices = fs.vertices();
+				const W* fsWeights = fs.weights();
+				for (size_t e = 0; e < fs.size(); ++e)
+				{
+					if ((fsWeights[e] <= bucketWidth) == light)
+					{
+						W newDist = vDist + fsWeights[e];
+						if (_atomicMin(dist[fsVertices[e]], newDist))
+						{
+							threadRequests.emplace_back((size_t)(newDist / bucketWidth), fsVertices[e]);
+						}
+					}
+				}
+			}
+		}
+
+		for (auto& threadRequests : requests)
+		{
+			for (const auto& request : threadRequests)
+			{
+				if (request.first >= buckets.size())
+				{
+					buckets.resize(request.first + 1);
+				}
+				buckets[request.first].push_back(request.second);
+			}
+			threadRequests.clear();
+		}
+	};
+
+	dist[src] = 0;
+	buckets[0].push_back(src);
+
+	std::vector<V> frontier;
+	std::vector<V> settled;
+	for (size_t b = 0; b < buckets.size(); ++b)
+	{
+		settled.clear();
+
+		// Relax light edges until no vertex enters current bucket
+		while (!buckets[b].empty())
+		{
+			frontier.clear();
+			for (V v : buckets[b])
+			{
+				if ((size_t)(dist[v] / bucketWidth) == b)
+				{
+					frontier.push_back(v);
+				}
+			}
+			buckets[b].clear();
+
+			std::sort(frontier.begin(), frontier.end());
+			frontier.erase(std::unique(frontier.begin(), frontier.end()), frontier.end());
+			settled.insert(settled.end(), frontier.begin(), frontier.end());
+
+			relax(frontier, true);
+		}
+
+		std::sort(settled.begin(), settled.end());
+		settled.erase(std::unique(settled.begin(), settled.end()), settled.end());
+
+		// Heavy edges lead to following buckets only
+		relax(settled, false);
+
+		std::sort(settled.begin(), settled.end(), [&dist](V v, V w) { return dist[v] < dist[w]; });
+		visitStack.insert(visitStack.end(), settled.begin(), settled.end());
+	}
+}
+
+template<typename V, typename W>
+bool fastbc::brandes::DeltaSteppingSSBrandesBC<V, W>::_atomicMin(W& target, W value)
+{
+	W current;
+	__atomic_load(&target, &current, __ATOMIC_RELAXED);
+
+	while (value < current)
+	{
+		if (__atomic_compare_exchange(&target, &current, &value, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+#endif
@@ -2,90 +2,131 @@
 #define FASTBC_BRANDES_DIJKSTRACLUSTEREVALUATOR_H
 
 #include "IClusterEvaluator.h"
+#include <LocalSubGraph.h>
+#include <queue/DefaultQueue.h>
 
-#include <list>
+#include <algorithm>
+#include <limits>
 #include <memory>
-#include <set>
-#include <stack>
 #include <vector>
 #include <utility>
 
 namespace fastbc {
 	namespace brandes {
 
-		template<typename V, typename W>
+		/**
+		 *	@brief Cluster evaluator computing intra-cluster BC with Dijkstra's algorithm
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for edge weight value
+		 *	@tparam Queue Priority queue policy used by Dijkstra's algorithm (see queue::SetQueue)
+		 */
+		template<typename V, typename W, typename Queue = queue::DefaultQueue<V, W>>
 		class DijkstraClusterEvaluator : public IClusterEvaluator<V, W>
 		{
 		public:
 
 			void evaluateCluster(
 				std::vector<W>& clusterBC,
-				std::vector<std::shared_ptr<VertexInfo<V, W>>>& globalVI,
+				VertexInfoMatrix<V, W>& clusterVI,
 				std::shared_ptr<const ISubGraph<V, W>> cluster) override;
 
 		private:
 
-			struct vertex_backtrack_info_t
-			{
-				W sigma = 0;
-				std::list<V> spPred;
-			};
+			// End of predecessors list marker
+			static constexpr size_t _none = std::numeric_limits<size_t>::max();
 
+			/*
+			 *	@brief Shortest paths information indexed by cluster local vertex
+			 *
+			 *	@details Shortest paths predecessors of each vertex are linked lists stored
+			 *			 in a single buffer, starting from spPredHead entry of the vertex
+			 */
 			struct backtrack_info_t
 			{
-				std::stack<V> visitStack;
-				std::map<V, vertex_backtrack_info_t> spBacktrack;
+				void resize(size_t vertexCount)
+				{
+					dist.resize(vertexCount);
+					sigma.resize(vertexCount);
+					delta.resize(vertexCount);
+					spPredHead.resize(vertexCount);
+					visitQueue.reserve(vertexCount);
+				}
+
+				std::vector<W> dist;
+				std::vector<W> sigma;
+				std::vector<W> delta;
+				std::vector<size_t> spPredHead;
+				std::vector<std::pair<V, size_t>> spPred;
+				std::vector<V> visitStack;
+				Queue visitQueue;
 			};
 
-			backtrack_info_t _dijkstra_SSSP(
-				std::vector<std::shared_ptr<VertexInfo<V, W>>>& globalVI,
+			/*
+			 *	@brief Get shortest paths information of calling thread, sized on given vertices count
+			 */
+			static backtrack_info_t& _local(size_t vertexCount);
+
+			void _dijkstra_SSSP(
+				VertexInfoMatrix<V, W>& clusterVI,
+				size_t row,
 				V src,
-				std::shared_ptr<const ISubGraph<V, W>> graph);
+				const LocalSubGraph<V, W>& graph,
+				backtrack_info_t& backtrackInfo);
 
 		};
 
 	}
 }
 
-template<typename V, typename W>
-void fastbc::brandes::DijkstraClusterEvaluator<V, W>::evaluateCluster(
+template<typename V, typename W, typename Queue>
+void fastbc::brandes::DijkstraClusterEvaluator<V, W, Queue>::evaluateCluster(
 	std::vector<W>& clusterBC,
-	std::vector<std::shared_ptr<VertexInfo<V, W>>>& globalVI,
+	VertexInfoMatrix<V, W>& clusterVI,
 	std::shared_ptr<const ISubGraph<V, W>> cluster)
 {
-	W* _clusterBC = clusterBC.data();
-	size_t _clusterBCsize = clusterBC.size();
-
-	#pragma omp parallel
+	// Work on local vertex indices, copying the cluster when not already in local form
+	std::shared_ptr<const LocalSubGraph<V, W>> localCluster =
+		std::dynamic_pointer_cast<const LocalSubGraph<V, W>>(cluster);
+	if (!localCluster)
 	{
-		// Partial dependency vertices map
-		std::map<V, W> delta;
-		for (const auto& v : cluster->vertices()) { delta[v] = 0; }
+		localCluster = std::make_shared<LocalSubGraph<V, W>>(cluster->vertices(), cluster->referenceGraph());
+	}
+
+	// One row of vertex information for each cluster vertex
+	clusterVI = VertexInfoMatrix<V, W>(cluster->vertices().size(), localCluster->localBorders().size());
 
-		// Compute SP from each cluster vertex
-		#pragma omp for reduction(+:_clusterBC[:_clusterBCsize])
-		for (size_t srcIndex = 0; srcIndex < cluster->vertices().size(); ++srcIndex)
+	// BC of cluster vertices, by local index
+	std::vector<W> localBC(cluster->vertices().size(), (W)0);
+
+	// Compute SP from each cluster vertex
+	this->_sourceTasks(cluster->vertices().size(), cluster->vertices().size(), cluster->edges(), localBC,
+		[&](size_t srcIndex, W* _clusterBC)
 		{
-			const V& src = cluster->vertices()[srcIndex];
+			// Shortest paths and partial dependency of cluster vertices
+			backtrack_info_t& bi = _local(cluster->vertices().size());
+			auto& visitStack = bi.visitStack;
+			auto& delta = bi.delta;
 
-			// Reset partial dependency structure before starting
-			for (auto& vw : delta) { vw.second = 0; }
+			V src = localCluster->localIndex(cluster->vertices()[srcIndex]);
 
 			// Compute shortest path storing border information 
-			struct backtrack_info_t bi = _dijkstra_SSSP(globalVI, src, cluster);
-			auto& visitStack = bi.visitStack;
-			auto& backtrackInfo = bi.spBacktrack;
+			_dijkstra_SSSP(clusterVI, srcIndex, src, *localCluster, bi);
+
+			// Reset partial dependency structure before starting
+			std::fill(delta.begin(), delta.end(), 0);
 
 			// Backward visit of each vertex from dijkstra iteration 
 			while (!visitStack.empty())
 			{
-				V w = visitStack.top();
-				visitStack.pop();
+				V w = visitStack.back();
+				visitStack.pop_back();
 
 				// Compute each vertex dependency for current src
-				for (auto& v : backtrackInfo[w].spPred)
+				for (size_t e = bi.spPredHead[w]; e != _none; e = bi.spPred[e].second)
 				{
-					W c = backtrackInfo[v].sigma / backtrackInfo[w].sigma * (1.0 + delta[w]);
+					V v = bi.spPred[e].first;
+					W c = bi.sigma[v] / bi.sigma[w] * (1.0 + delta[w]);
 
 					delta[v] += c;
 				}
@@ -95,88 +136,114 @@ void fastbc::brandes::DijkstraClusterEvaluator<V, W>::evaluateCluster(
 					_clusterBC[w] += delta[w];
 				}
 			}
-		}
+		});
+
+	// Map cluster BC back to global vertex indices
+	for (size_t local = 0; local < localBC.size(); ++local)
+	{
+		clusterBC[localCluster->globalIndex(local)] += localBC[local];
+	}
+}
+
+template<typename V, typename W, typename Queue>
+typename fastbc::brandes::DijkstraClusterEvaluator<V, W, Queue>::backtrack_info_t&
+fastbc::brandes::DijkstraClusterEvaluator<V, W, Queue>::_local(size_t vertexCount)
+{
+	static thread_local backtrack_info_t backtrackInfo;
+
+	if (backtrackInfo.dist.size() != vertexCount)
+	{
+		backtrackInfo.resize(vertexCount);
 	}
+
+	return backtrackInfo;
 }
 
-template<typename V, typename W>
-struct fastbc::brandes::DijkstraClusterEvaluator<V, W>::backtrack_info_t
-fastbc::brandes::DijkstraClusterEvaluator<V, W>::_dijkstra_SSSP(
-	std::vector<std::shared_ptr<VertexInfo<V, W>>>& globalVI,
+template<typename V, typename W, typename Queue>
+void fastbc::brandes::DijkstraClusterEvaluator<V, W, Queue>::_dijkstra_SSSP(
+	VertexInfoMatrix<V, W>& clusterVI,
+	size_t row,
 	V src,
-	std::shared_ptr<const ISubGraph<V, W>> graph)
+	const LocalSubGraph<V, W>& graph,
+	backtrack_info_t& backtrackInfo)
 {
-	// Output information data structure
-	struct backtrack_info_t backtrackInfo;
 	auto& visitStack = backtrackInfo.visitStack;
-	auto& vertexBInfo = backtrackInfo.spBacktrack;
+	auto& dist = backtrackInfo.dist;
+	auto& sigma = backtrackInfo.sigma;
+	auto& spPredHead = backtrackInfo.spPredHead;
+	auto& spPred = backtrackInfo.spPred;
 
-	// Map holding distances from the source.
-	std::map<V, W> dist;
-	for (const auto& v : graph->vertices()) { dist[v] = std::numeric_limits<W>::max(); }
+	// Reset distances from the source and shortest paths information
+	std::fill(dist.begin(), dist.end(), std::numeric_limits<W>::max());
+	std::fill(sigma.begin(), sigma.end(), 0);
+	std::fill(spPredHead.begin(), spPredHead.end(), _none);
+	spPred.clear();
 
 	// Queue used for the Dijkstra's algorithm. Ordered by nearest vertex to src
-	auto distCmp = [&dist](const V& lhs, const V& rhs) { 
-		if(dist[lhs] == dist[rhs])
-			return lhs < rhs;
-		return dist[lhs] < dist[rhs]; 
-	};
-	std::set<V, decltype(distCmp)> visitQueue(distCmp);
+	auto& visitQueue = backtrackInfo.visitQueue;
 
 	// Init src information
-	vertexBInfo[src].sigma = 1;
+	sigma[src] = 1;
 	dist[src] = 0;
-	visitQueue.insert(src);
+	visitQueue.push(src, 0);
 
 	// While there are still elements in the queue.
 	while (!visitQueue.empty())
 	{
 		// Pop the first
-		V v = *visitQueue.begin();
-		visitQueue.erase(visitQueue.begin());
+		V v = visitQueue.pop();
 
 		// Push vertex to visited stack
-		visitStack.push(v);
+		visitStack.push_back(v);
 
 		// Check the neighbors w of v.
-		for (const auto& it : graph->forwardStar(v))
+		const auto fs = graph.localForwardStar(v);
+		const V* fsVertices = fs.vertices();
+		const W* fsWeights = fs.weights();
+		for (size_t i = 0; i < fs.size(); ++i)
 		{
-			V w = it.first;
-			W newDist = dist[v] + it.second;
+			V w = fsVertices[i];
+			W newDist = dist[v] + fsWeights[i];
 
 			// Node w found for the first time or the new distance is shorter?
 			if (newDist < dist[w])
 			{
-				visitQueue.erase(w);
+				if (dist[w] == std::numeric_limits<W>::max())
+				{
+					visitQueue.push(w, newDist);
+				}
+				else
+				{
+					visitQueue.decrease(w, newDist);
+				}
 				dist[w] = newDist;
-				visitQueue.insert(w);
-				vertexBInfo[w].spPred.clear();
-				vertexBInfo[w].sigma = 0;
+				spPredHead[w] = _none;
+				sigma[w] = 0;
 			}
 
 			// Is the shortest path to w via u?
 			if (newDist == dist[w])
 			{
-				vertexBInfo[w].spPred.push_back(v);
-				vertexBInfo[w].sigma += vertexBInfo[v].sigma;
+				spPred.emplace_back(v, spPredHead[w]);
+				spPredHead[w] = spPred.size() - 1;
+				sigma[w] += sigma[v];
 			}
 		}
 	}
 
 	// Annotate shortest path length and count information from current src to border vertices
-	const auto& borders = graph->borders();
-	V storeIndex = 0;
-	globalVI[src] = std::make_shared<VertexInfo<V, W>>(borders.size());
-	for (const auto& b : borders)
+	const auto& borders = graph.localBorders();
+	W* lengths = clusterVI.lengths(row);
+	V* counts = clusterVI.counts(row);
+	for (size_t storeIndex = 0; storeIndex < borders.size(); ++storeIndex)
 	{
+		const V& b = borders[storeIndex];
+
 		// BE AWARE: SP lentgh from unreached border is converted to zero to enable 
 		// 			 correct VertexInfo distance computation
-		globalVI[src]->setBorderSPLength(storeIndex, dist[b] != std::numeric_limits<W>::max() ? dist[b] : 0);
-		globalVI[src]->setBorderSPCount(storeIndex, vertexBInfo[b].sigma);
-		storeIndex++;
+		lengths[storeIndex] = dist[b] != std::numeric_limits<W>::max() ? dist[b] : 0;
+		counts[storeIndex] = sigma[b];
 	}
-
-	return backtrackInfo;
 }
 
-#endif
\ No newline at end of file
+#endif
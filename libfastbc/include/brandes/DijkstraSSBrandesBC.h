@@ -2,17 +2,24 @@
 #define FASTBC_BRANDES_DIJKSTRASSBRANDESBC_H
 
 #include "ISSBrandesBC.h"
+#include "SSSPWorkspace.h"
+#include <queue/DefaultQueue.h>
 
-#include <list>
-#include <set>
-#include <stack>
+#include <limits>
 #include <vector>
 #include <utility>
 
 namespace fastbc {
 	namespace brandes {
 
-		template<typename V, typename W>
+		/**
+		 *	@brief Single source Brandes' dependency computation based on Dijkstra's algorithm
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for edge weight value
+		 *	@tparam Queue Priority queue policy used by Dijkstra's algorithm (see queue::SetQueue)
+		 */
+		template<typename V, typename W, typename Queue = queue::DefaultQueue<V, W>>
 		class DijkstraSSBrandesBC : public ISSBrandesBC<V, W>
 		{
 		public:
@@ -20,130 +27,197 @@ namespace fastbc {
 				V source,
 				std::shared_ptr<const IGraph<V, W>> graph) override;
 
-		private:
+			void accumulateBrandes(
+				V source,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				W scale,
+				W* bc) override;
 
-			struct vertex_backtrack_info_t
-			{
-				W sigma = 0;
-				std::list<V> spPred;
-			};
+			W accumulateWeightedBrandes(
+				V source,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				const std::vector<W>& vertexWeights,
+				W scale,
+				W* bc,
+				W* reached) override;
 
-			struct backtrack_info_t
-			{
-				std::stack<V> visitStack;
-				std::vector<vertex_backtrack_info_t> spBacktrack;
-			};
+		private:
+
+			W _accumulate(
+				V source,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				const W* vertexWeights,
+				W scale,
+				W* bc,
+				W* reached);
 
-			backtrack_info_t _dijkstra_SSSP(
+			void _dijkstra_SSSP(
 				V src,
-				std::shared_ptr<const IGraph<V, W>> graph);
+				std::shared_ptr<const IGraph<V, W>> graph,
+				SSSPWorkspace<V, W, Queue>& workspace);
 		};
 
 	}
 }
 
-template<typename V, typename W>
-std::vector<W> fastbc::brandes::DijkstraSSBrandesBC<V, W>::singleSourceBrandes(
+template<typename V, typename W, typename Queue>
+std::vector<W> fastbc::brandes::DijkstraSSBrandesBC<V, W, Queue>::singleSourceBrandes(
 	V source,
 	std::shared_ptr<const IGraph<V, W>> graph)
 {
-	// Compute shortest path storing border information 
-	struct backtrack_info_t bi = _dijkstra_SSSP(source, graph);
-	auto& visitStack = bi.visitStack;
-	auto& backtrackInfo = bi.spBacktrack;
+	std::vector<W> ssBC(graph->vertices().size(), (W)0);
 
-	// Partial vertices dependency
-	std::vector<W> delta(graph->vertices().size(), 0);
+	accumulateBrandes(source, graph, 1, ssBC.data());
 
-	std::vector<W> ssBC(graph->vertices().size(), (W)0);
+	return ssBC;
+}
+
+template<typename V, typename W, typename Queue>
+void fastbc::brandes::DijkstraSSBrandesBC<V, W, Queue>::accumulateBrandes(
+	V source,
+	std::shared_ptr<const IGraph<V, W>> graph,
+	W scale,
+	W* bc)
+{
+	_accumulate(source, graph, nullptr, scale, bc, nullptr);
+}
+
+template<typename V, typename W, typename Queue>
+W fastbc::brandes::DijkstraSSBrandesBC<V, W, Queue>::accumulateWeightedBrandes(
+	V source,
+	std::shared_ptr<const IGraph<V, W>> graph,
+	const std::vector<W>& vertexWeights,
+	W scale,
+	W* bc,
+	W* reached)
+{
+	return _accumulate(source, graph, vertexWeights.data(), scale, bc, reached);
+}
+
+template<typename V, typename W, typename Queue>
+W fastbc::brandes::DijkstraSSBrandesBC<V, W, Queue>::_accumulate(
+	V source,
+	std::shared_ptr<const IGraph<V, W>> graph,
+	const W* vertexWeights,
+	W scale,
+	W* bc,
+	W* reached)
+{
+	// Shortest paths buffers are allocated once per thread and reused between sources
+	SSSPWorkspace<V, W, Queue>& workspace = SSSPWorkspace<V, W, Queue>::local();
+	workspace.prepare(graph->vertices().size());
+
+	// Compute shortest path storing border information 
+	_dijkstra_SSSP(source, graph, workspace);
+	const auto& visitStack = workspace.visitStack;
+	const auto& sigma = workspace.sigma;
+	auto& delta = workspace.delta;
+
+	// Without vertex weights each vertex stands for itself only
+	W sourceWeight = vertexWeights ? vertexWeights[source] : 1;
 
 	// Backward visit of each vertex from dijkstra iteration 
-	while (!visitStack.empty())
+	for (auto it = visitStack.rbegin(); it != visitStack.rend(); ++it)
 	{
-		V w = visitStack.top();
-		visitStack.pop();
+		V w = *it;
+		W weight = vertexWeights ? vertexWeights[w] : 1;
 
 		// Compute each vertex dependency for current src
-		for (const auto& v : backtrackInfo[w].spPred)
+		for (size_t e = workspace.spPredHead[w]; e != workspace.none; e = workspace.spPred[e].second)
 		{
-			W c = backtrackInfo[v].sigma / backtrackInfo[w].sigma * (1.0 + delta[w]);
+			V v = workspace.spPred[e].first;
+			W c = sigma[v] / sigma[w] * (weight + delta[w]);
 
 			delta[v] += c;
 		}
 
 		if (w != source)
 		{
-			ssBC[w] += delta[w];
+			// Vertices of w group other than w are reached through it
+			bc[w] += (delta[w] + (weight - 1)) * sourceWeight * scale;
+
+			if (reached)
+			{
+				reached[w] += sourceWeight * scale;
+			}
 		}
 	}
 
-	return ssBC;
+	// Source is inner vertex of the paths from the other vertices of its group
+	W reach = delta[source];
+	if (sourceWeight != 1)
+	{
+		bc[source] += (sourceWeight - 1) * reach * scale;
+	}
+
+	workspace.release();
+
+	return reach;
 }
 
-template<typename V, typename W>
-struct fastbc::brandes::DijkstraSSBrandesBC<V, W>::backtrack_info_t
-fastbc::brandes::DijkstraSSBrandesBC<V, W>::_dijkstra_SSSP(
+template<typename V, typename W, typename Queue>
+void fastbc::brandes::DijkstraSSBrandesBC<V, W, Queue>::_dijkstra_SSSP(
 	V src,
-	std::shared_ptr<const IGraph<V, W>> graph)
+	std::shared_ptr<const IGraph<V, W>> graph,
+	SSSPWorkspace<V, W, Queue>& workspace)
 {
-	// Output information data structure
-	struct backtrack_info_t backtrackInfo;
-	auto& visitStack = backtrackInfo.visitStack;
-	auto& vertexBInfo = backtrackInfo.spBacktrack;
-	vertexBInfo.resize(graph->vertices().size());
-
-	// Map holding distances from the source.
-	std::vector<W> dist(graph->vertices().size(), std::numeric_limits<W>::max());
+	auto& visitStack = workspace.visitStack;
+	auto& dist = workspace.dist;
+	auto& sigma = workspace.sigma;
+	auto& spPredHead = workspace.spPredHead;
+	auto& spPred = workspace.spPred;
 
 	// Queue used for the Dijkstra's algorithm. Ordered by nearest vertex to src
-	auto distCmp = [&dist](const V& lhs, const V& rhs) { 
-		if(dist[lhs] == dist[rhs])
-			return lhs < rhs;
-		return dist[lhs] < dist[rhs]; 
-	};
-	std::set<V, decltype(distCmp)> visitQueue(distCmp);
+	auto& visitQueue = workspace.visitQueue;
 
 	// Init src information
-	vertexBInfo[src].sigma = 1;
+	sigma[src] = 1;
 	dist[src] = 0;
-	visitQueue.insert(src);
+	visitQueue.push(src, 0);
 
 	// While there are still elements in the queue.
 	while (!visitQueue.empty())
 	{
 		// Pop the first
-		V v = *visitQueue.begin();
-		visitQueue.erase(visitQueue.begin());
+		V v = visitQueue.pop();
 
 		// Push vertex to visited stack
-		visitStack.push(v);
+		visitStack.push_back(v);
 
 		// Check the neighbors w of v.
-		for (const auto& it : graph->forwardStar(v))
+		const auto fs = graph->forwardStar(v);
+		const V* fsVertices = fs.vertices();
+		const W* fsWeights = fs.weights();
+		for (size_t i = 0; i < fs.size(); ++i)
 		{
-			V w = it.first;
-			W newDist = dist[v] + it.second;
+			V w = fsVertices[i];
+			W newDist = dist[v] + fsWeights[i];
 
 			// Node w found for the first time or the new distance is shorter?
 			if (newDist < dist[w])
 			{
-				visitQueue.erase(w);
+				if (dist[w] == std::numeric_limits<W>::max())
+				{
+					visitQueue.push(w, newDist);
+				}
+				else
+				{
+					visitQueue.decrease(w, newDist);
+				}
 				dist[w] = newDist;
-				visitQueue.insert(w);
-				vertexBInfo[w].spPred.clear();
-				vertexBInfo[w].sigma = 0;
+				spPredHead[w] = workspace.none;
+				sigma[w] = 0;
 			}
 
 			// Is the shortest path to w via u?
 			if (newDist == dist[w])
 			{
-				vertexBInfo[w].spPred.push_back(v);
-				vertexBInfo[w].sigma += vertexBInfo[v].sigma;
+				spPred.emplace_back(v, spPredHead[w]);
+				spPredHead[w] = spPred.size() - 1;
+				sigma[w] += sigma[v];
 			}
 		}
 	}
-
-	return backtrackInfo;
 }
 
 #endif
\ No newline at end of file
@@ -1,84 +1,155 @@
 #ifndef FASTBC_BRANDES_EXACTBRANDESBC_H
 #define FASTBC_BRANDES_EXACTBRANDESBC_H
 
+#include "BFSSSBrandesBC.h"
+#include "DeltaSteppingSSBrandesBC.h"
 #include "IBrandesBC.h"
+#include "ParallelAccumulator.h"
+#include "SSSPWorkspace.h"
+#include <EdgeWeights.h>
+#include <queue/BucketQueue.h>
+#include <queue/DefaultQueue.h>
 
-#include <functional>
-#include <list>
+#include <limits>
 #include <memory>
-#include <set>
-#include <stack>
+#include <spdlog/spdlog.h>
 #include <vector>
 
 namespace fastbc {
     namespace brandes {
 
-        template<typename V, typename W>
+        /**
+         *	@brief Exact Brandes' betweenness centrality computation
+         *
+         *	@details Graphs whose edges share the same weight are visited by breadth
+         *			 first search (see BFSSSBrandesBC) instead of Dijkstra's algorithm.
+         *			 Graphs with small integer weights are visited by Dijkstra's algorithm
+         *			 with a bucket queue (see queue::BucketQueue), whatever the Queue policy.
+         *			 Sources can be visited one at a time instead, in parallel within each
+         *			 source (see DeltaSteppingSSBrandesBC).
+         *
+         *	@tparam V Type for vertex index number
+         *	@tparam W Type for edge weight value
+         *	@tparam Queue Priority queue policy used by Dijkstra's algorithm (see queue::SetQueue)
+         */
+        template<typename V, typename W, typename Queue = queue::DefaultQueue<V, W>>
         class ExactBrandesBC : public IBrandesBC<V, W>
         {
         public:
+            /**
+             *	@brief Initialize an exact Brandes' BC computer
+             *
+             *	@param deltaStepping Visit sources one at a time, computing shortest paths of
+             *						 each source in parallel by delta-stepping. Worth it when
+             *						 graph vertices are fewer than threads only.
+             */
+            ExactBrandesBC(bool deltaStepping = false);
+
             std::vector<W> computeBC(const std::shared_ptr<const IGraph<V, W>> graph) override;
 
 
         private:
+			const bool _deltaStepping;
 
-            struct vertex_backtrack_info_t
-			{
-				W sigma = 0;
-				std::list<V> spPred;
-			};
-
-			struct backtrack_info_t
-			{
-				std::stack<V> visitStack;
-				std::vector<struct vertex_backtrack_info_t> spBacktrack;
-			};
-
-			backtrack_info_t _dijkstra_SSSP(
+			void _dijkstra_SSSP(
 				V src,
-				std::shared_ptr<const IGraph<V, W>> graph);
+				std::shared_ptr<const IGraph<V, W>> graph,
+				SSSPWorkspace<V, W, Queue>& workspace);
         };
 
     }
 }
 
-template<typename V, typename W>
-std::vector<W> fastbc::brandes::ExactBrandesBC<V, W>::computeBC(
+template<typename V, typename W, typename Queue>
+fastbc::brandes::ExactBrandesBC<V, W, Queue>::ExactBrandesBC(bool deltaStepping)
+	: _deltaStepping(deltaStepping)
+{
+}
+
+template<typename V, typename W, typename Queue>
+std::vector<W> fastbc::brandes::ExactBrandesBC<V, W, Queue>::computeBC(
     const std::shared_ptr<const IGraph<V, W>> graph)
 {
     std::vector<W> globalBC(graph->vertices().size(), (W)0);
-    W* _globalBC = globalBC.data();
-	size_t _globalBCsize = globalBC.size();
+
+	// Parallelize within each source instead of across sources
+	if (_deltaStepping)
+	{
+		SPDLOG_INFO("Computing shortest paths of each source by delta-stepping");
+
+		DeltaSteppingSSBrandesBC<V, W> deltaStepping;
+		for (const V& src : graph->vertices())
+		{
+			deltaStepping.accumulateBrandes(src, graph, 1, globalBC.data());
+		}
+
+		return globalBC;
+	}
+
+	// Each thread sums dependencies to its own buffer, merged once at the end
+	ParallelAccumulator<W> accumulator(globalBC.size());
+
+	// Uniform edge weights do not need a priority queue
+	EdgeWeights<V, W> weights(*graph);
+	if (weights.uniform())
+	{
+		SPDLOG_INFO("Uniform edge weights, computing shortest paths by breadth first search");
+
+		BFSSSBrandesBC<V, W> bfs;
+
+		#pragma omp parallel
+		{
+			W* _globalBC = accumulator.local();
+
+			#pragma omp for schedule(dynamic, 1)
+			for (size_t srcIndex = 0; srcIndex < graph->vertices().size(); ++srcIndex)
+			{
+				bfs.accumulateBrandes(graph->vertices()[srcIndex], graph, 1, _globalBC);
+			}
+		}
+
+		accumulator.mergeInto(globalBC.data());
+
+		return globalBC;
+	}
+
+	if (useBucketQueue<Queue>(weights))
+	{
+		return ExactBrandesBC<V, W, queue::BucketQueue<V, W>>().computeBC(graph);
+	}
 
 	#pragma omp parallel
 	{
-		// Partial dependency vertices map
-		std::vector<W> delta(graph->vertices().size(), (W)0);
+		W* _globalBC = accumulator.local();
+
+		// Shortest paths buffers are reused by each source computed on this thread
+		SSSPWorkspace<V, W, Queue>& workspace = SSSPWorkspace<V, W, Queue>::local();
+		const auto& visitStack = workspace.visitStack;
+		const auto& sigma = workspace.sigma;
+		auto& delta = workspace.delta;
 
 		// Compute SP from each cluster vertex
-		#pragma omp for reduction(+:_globalBC[:_globalBCsize])
+		#pragma omp for
 		for (size_t srcIndex = 0; srcIndex < graph->vertices().size(); ++srcIndex)
 		{
 			const V& src = graph->vertices()[srcIndex];
 
-			// Reset partial dependency structure before starting
-			delta.assign(delta.size(), 0);
+			// Reset shortest paths and partial dependency structures before starting
+			workspace.prepare(graph->vertices().size());
 
 			// Compute shortest path storing border information 
-			struct backtrack_info_t bi = _dijkstra_SSSP(src, graph);
-			auto& visitStack = bi.visitStack;
-			auto& backtrackInfo = bi.spBacktrack;
+			_dijkstra_SSSP(src, graph, workspace);
 
 			// Backward visit of each vertex from dijkstra iteration 
-			while (!visitStack.empty())
+			for (auto it = visitStack.rbegin(); it != visitStack.rend(); ++it)
 			{
-				V w = visitStack.top();
-				visitStack.pop();
+				V w = *it;
 
 				// Compute each vertex dependency for current src
-				for (auto& v : backtrackInfo[w].spPred)
+				for (size_t e = workspace.spPredHead[w]; e != workspace.none; e = workspace.spPred[e].second)
 				{
-					W c = backtrackInfo[v].sigma / backtrackInfo[w].sigma * (1.0 + delta[w]);
+					V v = workspace.spPred[e].first;
+					W c = sigma[v] / sigma[w] * (1.0 + delta[w]);
 
 					delta[v] += c;
 				}
@@ -88,76 +159,79 @@ std::vector<W> fastbc::brandes::ExactBrandesBC<V, W>::computeBC(
 					_globalBC[w] += delta[w];
 				}
 			}
+
+			workspace.release();
 		}
 	}
 
+	accumulator.mergeInto(globalBC.data());
+
     return globalBC;
 }
 
-template<typename V, typename W>
-struct fastbc::brandes::ExactBrandesBC<V, W>::backtrack_info_t
-fastbc::brandes::ExactBrandesBC<V, W>::_dijkstra_SSSP(
+template<typename V, typename W, typename Queue>
+void fastbc::brandes::ExactBrandesBC<V, W, Queue>::_dijkstra_SSSP(
 	V src,
-	std::shared_ptr<const IGraph<V, W>> graph)
+	std::shared_ptr<const IGraph<V, W>> graph,
+	SSSPWorkspace<V, W, Queue>& workspace)
 {
-	// Output information data structure
-	struct backtrack_info_t backtrackInfo;
-	auto& visitStack = backtrackInfo.visitStack;
-	auto& vertexBInfo = backtrackInfo.spBacktrack;
-	vertexBInfo.resize(graph->vertices().size());
-
-	// Map holding distances from the source.
-	std::vector<W> dist(graph->vertices().size(), std::numeric_limits<W>::max());
+	auto& visitStack = workspace.visitStack;
+	auto& dist = workspace.dist;
+	auto& sigma = workspace.sigma;
+	auto& spPredHead = workspace.spPredHead;
+	auto& spPred = workspace.spPred;
 
 	// Queue used for the Dijkstra's algorithm. Ordered by nearest vertex to src
-	auto distCmp = [&dist](const V& lhs, const V& rhs) { 
-		if(dist[lhs] == dist[rhs])
-			return lhs < rhs;
-		return dist[lhs] < dist[rhs]; 
-	};
-	std::set<V, decltype(distCmp)> visitQueue(distCmp);
+	auto& visitQueue = workspace.visitQueue;
 
 	// Init src information
-	vertexBInfo[src].sigma = 1;
+	sigma[src] = 1;
 	dist[src] = 0;
-	visitQueue.insert(src);
+	visitQueue.push(src, 0);
 
 	// While there are still elements in the queue.
 	while (!visitQueue.empty())
 	{
 		// Pop the first
-		V v = *visitQueue.begin();
-		visitQueue.erase(visitQueue.begin());
+		V v = visitQueue.pop();
 
 		// Push vertex to visited stack
-		visitStack.push(v);
+		visitStack.push_back(v);
 
 		// Check the neighbors w of v.
-		for (const auto& it : graph->forwardStar(v))
+		const auto fs = graph->forwardStar(v);
+		const V* fsVertices = fs.vertices();
+		const W* fsWeights = fs.weights();
+		for (size_t i = 0; i < fs.size(); ++i)
 		{
-			V w = it.first;
-			W newDist = dist[v] + it.second;
+			V w = fsVertices[i];
+			W newDist = dist[v] + fsWeights[i];
 
 			// Node w found for the first time or the new distance is shorter?
 			if (newDist < dist[w])
 			{
-				visitQueue.erase(w);
+				if (dist[w] == std::numeric_limits<W>::max())
+				{
+					visitQueue.push(w, newDist);
+				}
+				else
+				{
+					visitQueue.decrease(w, newDist);
+				}
 				dist[w] = newDist;
-				visitQueue.insert(w);
-				vertexBInfo[w].spPred.clear();
-				vertexBInfo[w].sigma = 0;
+				spPredHead[w] = workspace.none;
+				sigma[w] = 0;
 			}
 
 			// Is the shortest path to w via u?
 			if (newDist == dist[w])
 			{
-				vertexBInfo[w].spPred.push_back(v);
-				vertexBInfo[w].sigma += vertexBInfo[v].sigma;
+				spPred.emplace_back(v, spPredHead[w]);
+				spPredHead[w] = spPred.size() - 1;
+				sigma[w] += sigma[v];
 			}
 		}
 	}
-
-	return backtrackInfo;
 }
 
 #endif
\ No newline at end of file
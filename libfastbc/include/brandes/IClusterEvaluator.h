@@ -2,11 +2,16 @@
 #define FASTBC_BRANDES_ICLUSTEREVALUATOR_H
 
 #include <ISubGraph.h>
-#include "VertexInfo.h"
+#include "ParallelAccumulator.h"
+#include "VertexInfoMatrix.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
+#include <omp.h>
+
 namespace fastbc {
 	namespace brandes {
 
@@ -22,21 +27,137 @@ namespace fastbc {
 			 *			 information about distance from border vertices and number of 
 			 *			 shortest paths through them
 			 * 
-			 *	@note clusterBC and globalVI must be already initialized with correct 
-			 *		  size of the global graph referenced by cluster sub-graph. 
+			 *	@note clusterBC must be already initialized with correct size of the 
+			 *		  global graph referenced by cluster sub-graph. 
 			 *		  Only cluster vertex indices will be modified during method call.
+			 *		  When called inside a parallel region, work is split in tasks run
+			 *		  by the threads of the enclosing team, otherwise a new team is started.
 			 * 
 			 *	@param clusterBC Computed BC value will be summed to given reference
-			 *	@param globalVI A new VertexInfo will be allocated for each of sub-graph vertices
+			 *	@param clusterVI Reinitialized with a row for each sub-graph vertex, in
+			 *					 cluster->vertices() order, and a column for each border
 			 *	@param cluster Sub-graph to apply computation to
 			 */
 			virtual void evaluateCluster(
 				std::vector<W>& clusterBC,
-				std::vector<std::shared_ptr<VertexInfo<V, W>>>& globalVI,
+				VertexInfoMatrix<V, W>& clusterVI,
 				std::shared_ptr<const ISubGraph<V,W>> cluster) = 0;
+
+			/**
+			 *	@brief Check if evaluateCluster computes internal BC, or vertices information only
+			 */
+			virtual bool computesClusterBC() const { return true; }
+
+		protected:
+			// Estimated cost, in visited vertices times edges, of a task of sources
+			static constexpr size_t _taskCost = size_t(1) << 16;
+
+			/**
+			 *	@brief Run body on each of given sources count as OpenMP tasks
+			 *
+			 *	@details Sources are split in about vertices * edges / _taskCost tasks,
+			 *			 so that small clusters are evaluated by a single task and large
+			 *			 ones by up to a task per source, run by any idle thread of the
+			 *			 enclosing team. Returns when all sources have been processed.
+			 *
+			 *	@param sources Number of sources, body is called on indices 0 to sources - 1
+			 *	@param vertices Number of cluster vertices
+			 *	@param edges Number of cluster edges
+			 *	@param body Function called on each source index
+			 */
+			template<typename F>
+			static void _sourceTasks(size_t sources, size_t vertices, size_t edges, F body);
+
+			/**
+			 *	@brief Run body on each of given sources count as OpenMP tasks, summing
+			 *		   values accumulated by body to given sums
+			 *
+			 *	@details Sources run by a single task accumulate directly to sums, otherwise
+			 *			 each thread running sources accumulates to its own buffer, merged
+			 *			 to sums when all sources have been processed.
+			 *
+			 *	@param sums Values accumulated by body will be summed to
+			 *	@param body Function called on each source index and accumulation buffer,
+			 *				of the same size of sums
+			 */
+			template<typename F>
+			static void _sourceTasks(size_t sources, size_t vertices, size_t edges, std::vector<W>& sums, F body);
+
+		private:
+			// Number of tasks sources are split in
+			static size_t _taskCount(size_t sources, size_t vertices, size_t edges);
 		};
 
 	}
 }
 
+template<typename V, typename W>
+template<typename F>
+void fastbc::brandes::IClusterEvaluator<V, W>::_sourceTasks(
+	size_t sources,
+	size_t vertices,
+	size_t edges,
+	F body)
+{
+	if (sources == 0)
+	{
+		return;
+	}
+
+	size_t tasks = _taskCount(sources, vertices, edges);
+	auto run = [&]()
+	{
+		#pragma omp taskloop num_tasks(tasks)
+		for (size_t s = 0; s < sources; ++s)
+		{
+			body(s);
+		}
+	};
+
+	// Tasks are bound to the innermost team, which must not be a nested one
+	if (omp_in_parallel())
+	{
+		run();
+	}
+	else
+	{
+		#pragma omp parallel
+		#pragma omp single
+		run();
+	}
+}
+
+template<typename V, typename W>
+template<typename F>
+void fastbc::brandes::IClusterEvaluator<V, W>::_sourceTasks(
+	size_t sources,
+	size_t vertices,
+	size_t edges,
+	std::vector<W>& sums,
+	F body)
+{
+	if (_taskCount(sources, vertices, edges) <= 1)
+	{
+		for (size_t s = 0; s < sources; ++s)
+		{
+			body(s, sums.data());
+		}
+		return;
+	}
+
+	ParallelAccumulator<W> accumulator(sums.size());
+	_sourceTasks(sources, vertices, edges,
+		[&](size_t s)
+		{
+			body(s, accumulator.local());
+		});
+	accumulator.mergeInto(sums.data());
+}
+
+template<typename V, typename W>
+size_t fastbc::brandes::IClusterEvaluator<V, W>::_taskCount(size_t sources, size_t vertices, size_t edges)
+{
+	return std::min(sources, vertices * edges / _taskCost + 1);
+}
+
 #endif
\ No newline at end of file
@@ -1,7 +1,7 @@
 #ifndef FASTBC_BRANDES_IPIVOTSELECTOR_H
 #define FASTBC_BRANDES_IPIVOTSELECTOR_H
 
-#include "VertexInfo.h"
+#include "VertexInfoMatrix.h"
 
 #include <memory>
 #include <set>
@@ -22,18 +22,18 @@ namespace fastbc {
 			 *	@details Generated pivots are vertices with smallest BC in their class and not
 			 *			 border; a class is composed of vertices with equal vertex information 
 			 * 
-			 *	@note Given VertexInfo references will be normalized and class caradinality will
-			 *		  be updated with correct value during the call
+			 *	@note Given vertices information rows will be normalized and class caradinality
+			 *		  will be updated with correct value during the call
 			 * 
 			 *	@param globalBC Betweenness centrality value for each vertex
-			 *	@param verticesInfo Vertex information for each vertex
+			 *	@param clusterVI Vertex information of each vertex, a row per vertex in vertices order
 			 *	@param vertices Vertices to be considered in the computation
 			 *	@param borders Vertices not to be considered as pivot
 			 *	@return std::pair<std::vector<V>, std::vector<V>> Selected pivot vertex indices and related class cardinality
 			 */
 			virtual std::pair<std::vector<V>, std::vector<V>> selectPivots(
 				const std::vector<W>& globalBC, 
-				const std::vector<std::shared_ptr<VertexInfo<V, W>>>& verticesInfo,
+				VertexInfoMatrix<V, W>& clusterVI,
 				const std::vector<V>& vertices,
 				const std::set<V>& borders) = 0;
 		};
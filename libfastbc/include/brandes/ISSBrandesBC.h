@@ -26,6 +26,56 @@ namespace fastbc {
 			virtual std::vector<W> singleSourceBrandes(
 				V source, 
 				std::shared_ptr<const IGraph<V, W>> graph) = 0;
+
+			/**
+			 *	@brief Sum scaled partial betweenness centrality values from given source vertex
+			 *		   to given buffer
+			 *
+			 *	@details Only vertices reached from source are accessed, hence the cost does
+			 *			 not depend on graph size when source reaches a small portion of it.
+			 *
+			 *	@note graph must be a complete graph (vertex indices from 0 to graph->vertices().size())
+			 *
+			 *	@param source Source vertex
+			 *	@param graph Full graph object
+			 *	@param scale Factor applied to each partial betweenness centrality value
+			 *	@param bc Buffer of graph->vertices().size() values where scaled values are summed
+			 */
+			virtual void accumulateBrandes(
+				V source,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				W scale,
+				W* bc) = 0;
+
+			/**
+			 *	@brief Sum scaled partial betweenness centrality values from given source vertex
+			 *		   to given buffer, on a graph whose vertices stand for groups of vertices
+			 *
+			 *	@details Each vertex v stands for itself and vertexWeights[v] - 1 other vertices
+			 *			 connected to the rest of the graph only through v, in both directions.
+			 *			 Partial values account for the shortest paths from each vertex of the
+			 *			 source group to each vertex of the other groups, counting v as inner
+			 *			 vertex of the paths from or to the other vertices of its own group.
+			 *			 With unit weights the values are the same of accumulateBrandes.
+			 *
+			 *	@note graph must be a complete graph (vertex indices from 0 to graph->vertices().size())
+			 *
+			 *	@param source Source vertex
+			 *	@param graph Full graph object
+			 *	@param vertexWeights Number of vertices each graph vertex stands for
+			 *	@param scale Factor applied to each partial betweenness centrality value
+			 *	@param bc Buffer of graph->vertices().size() values where scaled values are summed
+			 *	@param reached Buffer of graph->vertices().size() values where the scaled source
+			 *				   weight is summed for each vertex reached from source, if not null
+			 *	@return Total weight of the vertices reached from source, source excluded
+			 */
+			virtual W accumulateWeightedBrandes(
+				V source,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				const std::vector<W>& vertexWeights,
+				W scale,
+				W* bc,
+				W* reached) = 0;
 		};
 
 	}
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <memory>
 #include <spdlog/spdlog.h>
+#include <unordered_map>
 
 namespace fastbc {
 	namespace brandes {
@@ -21,7 +22,7 @@ namespace fastbc {
 			 * 
 			 * 	@details Pivot selection is first computed considering exact VertexInfo
 			 * 			 topological classes, then kmeans is applied to select a subset
-			 * 			 of those pivots based on VertexInfo::squaredDistance
+			 * 			 of those pivots based on VertexInfoMatrix::squaredDistance
 			 * 
 			 * 	@param exactPivotSelector Exact pivot selector used in first step
 			 * 	@param kmeans KMeans computer used in second step
@@ -38,7 +39,7 @@ namespace fastbc {
 
 			std::pair<std::vector<V>, std::vector<V>> selectPivots(
 				const std::vector<W>& globalBC,
-				const std::vector<std::shared_ptr<VertexInfo<V, W>>>& verticesInfo,
+				VertexInfoMatrix<V, W>& clusterVI,
 				const std::vector<V>& vertices,
 				const std::set<V>& borders) override;
 
@@ -80,13 +81,13 @@ template<typename V, typename W>
 std::pair<std::vector<V>, std::vector<V>> 
 fastbc::brandes::KMeansPivotSelector<V, W>::selectPivots(
 	const std::vector<W>& globalBC,
-	const std::vector<std::shared_ptr<VertexInfo<V, W>>>& verticesInfo,
+	VertexInfoMatrix<V, W>& clusterVI,
 	const std::vector<V>& vertices,
 	const std::set<V>& borders)
 {
 	// Compute exact topological classes and their pivots
 	const auto[pivotIndexCluster, pivotClassCluster] = 
-		_exactPS->selectPivots(globalBC, verticesInfo, vertices, borders);
+		_exactPS->selectPivots(globalBC, clusterVI, vertices, borders);
 
 	// Compute pivots subset cardinality
 	int k = std::max((int)(pivotIndexCluster.size() * _kFrac), 1);
@@ -94,12 +95,31 @@ fastbc::brandes::KMeansPivotSelector<V, W>::selectPivots(
 	SPDLOG_TRACE("Aggregating {} pivots in {} super-classes", 
 		pivotIndexCluster.size(), k);
 
+	// Vertex information rows of pivots
+	std::unordered_map<V, V> vertexRow;
+	vertexRow.reserve(vertices.size());
+	for (size_t row = 0; row < vertices.size(); ++row)
+	{
+		vertexRow.emplace(vertices[row], row);
+	}
+
+	std::vector<V> pivotRows(pivotIndexCluster.size());
+	for (size_t p = 0; p < pivotIndexCluster.size(); ++p)
+	{
+		pivotRows[p] = vertexRow[pivotIndexCluster[p]];
+	}
+
 	// Compute pivots subset through kmeans algorithm
 	// BE AWARE: duplicated pivots can result from kmeans due to the algorithm euristic nature
 	std::pair<std::vector<V>, std::vector<V>> pivotWeight = 
-		_kmeans->computeCentroids(k, pivotIndexCluster, pivotClassCluster, verticesInfo, 
+		_kmeans->computeCentroids(k, pivotRows, pivotClassCluster, clusterVI, 
 			_stopVariance, _maxIteration);
 
+	for (auto& pivot : pivotWeight.first)
+	{
+		pivot = vertices[pivot];
+	}
+
 #ifndef FASTBC_BRANDES_KMENS_PIVOT_ALLOW_DUPLICATED
 	// Remove duplicated pivots from kmeans result
 	std::set<V> uniquePivots;
@@ -0,0 +1,364 @@
+#ifndef FASTBC_BRANDES_MULTISOURCEBFSBRANDESBC_H
+#define FASTBC_BRANDES_MULTISOURCEBFSBRANDESBC_H
+
+#include <IGraph.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace fastbc {
+	namespace brandes {
+
+		/**
+		 *	@brief Brandes' dependency computation from a batch of sources at once, for graphs
+		 *		   with uniform edge weights
+		 *
+		 *	@details Up to lanes() sources, at most 64, are visited by a single breadth first
+		 *			 search: each source owns a bit lane of per-vertex 64 bit words, marking vertices
+		 *			 already seen and in current frontier for that source. Each edge is
+		 *			 scanned once per level for all sources reaching its tail at that level,
+		 *			 instead of once per source, sharing memory traffic of overlapping visits.
+		 *			 Shortest paths counts and dependencies are stored per vertex and lane,
+		 *			 and the vertices of each level are stored with the mask of lanes reaching
+		 *			 them at that level, used to back-propagate dependencies level by level.
+		 *
+		 *	@note Buffers of one value per vertex and lane are kept by each calling thread
+		 *		  (see workspaceBytes)
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for edge weight value
+		 */
+		template<typename V, typename W>
+		class MultiSourceBFSBrandesBC
+		{
+		public:
+			// Maximum number of sources in a batch
+			static constexpr size_t maxLanes = 64;
+
+			/**
+			 *	@brief Initialize a multi source breadth first search Brandes computer
+			 *
+			 *	@param lanes Maximum number of sources in a batch, from 1 to maxLanes
+			 */
+			MultiSourceBFSBrandesBC(size_t lanes = maxLanes);
+
+			/**
+			 *	@brief Get maximum number of sources in a batch
+			 */
+			size_t lanes() const;
+
+			/**
+			 *	@brief Estimate memory of visit buffers kept by each calling thread
+			 *
+			 *	@param vertexCount Graph vertices count
+			 *	@param lanes Maximum number of sources in a batch
+			 *	@return size_t Buffers size in bytes
+			 */
+			static size_t workspaceBytes(size_t vertexCount, size_t lanes);
+
+			/**
+			 *	@brief Get largest number of lanes whose buffers fit in given memory
+			 *
+			 *	@param vertexCount Graph vertices count
+			 *	@param threads Number of threads computing batches concurrently
+			 *	@param memory Memory available to buffers of all threads, in bytes
+			 *	@return size_t Number of lanes, at most maxLanes, 0 if none fits
+			 */
+			static size_t fittingLanes(size_t vertexCount, size_t threads, size_t memory);
+
+			/**
+			 *	@brief Sum scaled partial betweenness centrality values from given sources
+			 *		   to given buffer
+			 *
+			 *	@note graph must be a complete graph (vertex indices from 0 to graph->vertices().size())
+			 *
+			 *	@param sources Source vertices, at most lanes()
+			 *	@param graph Full graph object
+			 *	@param scales Factor applied to partial betweenness centrality values of each source
+			 *	@param bc Buffer of graph->vertices().size() values where scaled values are summed
+			 */
+			void accumulateBrandes(
+				const std::vector<V>& sources,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				const std::vector<W>& scales,
+				W* bc);
+
+		private:
+			using mask_t = uint64_t;
+
+			const size_t _lanes;
+
+			/*
+			 *	@brief Per-thread visit buffers, reset sparsely after each batch
+			 */
+			struct batch_workspace_t
+			{
+				std::vector<mask_t> seen;
+				std::vector<mask_t> visit;
+				std::vector<mask_t> visitNext;
+				std::vector<W> sigma;
+				std::vector<W> delta;
+
+				// Vertices reached at each level with the lanes reaching them
+				std::vector<std::pair<V, mask_t>> levelVertices;
+				std::vector<size_t> levels;
+			};
+
+			static batch_workspace_t& _local(size_t vertexCount, size_t lanes);
+		};
+
+	}
+}
+
+template<typename V, typename W>
+fastbc::brandes::MultiSourceBFSBrandesBC<V, W>::MultiSourceBFSBrandesBC(size_t lanes)
+	: _lanes(lanes)
+{
+	if (lanes == 0 || lanes > maxLanes)
+	{
+		SPDLOG_ERROR("Batches of {} sources requested, from 1 to {} allowed", lanes, maxLanes);
+		throw std::invalid_argument("Invalid batch lanes count");
+	}
+}
+
+template<typename V, typename W>
+size_t fastbc::brandes::MultiSourceBFSBrandesBC<V, W>::lanes() const
+{
+	return _lanes;
+}
+
+template<typename V, typename W>
+size_t fastbc::brandes::MultiSourceBFSBrandesBC<V, W>::workspaceBytes(size_t vertexCount, size_t lanes)
+{
+	// Lanes masks and, for each lane, shortest paths count and dependency of each vertex
+	return vertexCount * (3 * sizeof(mask_t) + 2 * lanes * sizeof(W));
+}
+
+template<typename V, typename W>
+size_t fastbc::brandes::MultiSourceBFSBrandesBC<V, W>::fittingLanes(size_t vertexCount, size_t threads, size_t memory)
+{
+	if (vertexCount == 0)
+	{
+		return maxLanes;
+	}
+
+	size_t threadMemory = memory / std::max(threads, (size_t)1);
+	size_t masksMemory = workspaceBytes(vertexCount, 0);
+	if (threadMemory <= masksMemory)
+	{
+		return 0;
+	}
+
+	return std::min(maxLanes, (threadMemory - masksMemory) / (2 * vertexCount * sizeof(W)));
+}
+
+template<typename V, typename W>
+void fastbc::brandes::MultiSourceBFSBrandesBC<V, W>::accumulateBrandes(
+	const std::vector<V>& sources,
+	std::shared_ptr<const IGraph<V, W>> graph,
+	const std::vector<W>& scales,
+	W* bc)
+{
+	if (sources.size() > _lanes || sources.size() != scales.size())
+	{
+		SPDLOG_ERROR("Batch of {} sources with {} scales, at most {} sources allowed",
+			sources.size(), scales.size(), _lanes);
+		throw std::invalid_argument("Invalid sources batch");
+	}
+
+	// Per vertex values of each lane are _lanes apart
+	const size_t lanes = _lanes;
+	batch_workspace_t& workspace = _local(graph->vertices().size(), lanes);
+	auto& seen = workspace.seen;
+	auto& visit = workspace.visit;
+	auto& visitNext = workspace.visitNext;
+	auto& sigma = workspace.sigma;
+	auto& delta = workspace.delta;
+	auto& levelVertices = workspace.levelVertices;
+	auto& levels = workspace.levels;
+
+	// Init sources information, as first level
+	levels.push_back(0);
+	for (size_t lane = 0; lane < sources.size(); ++lane)
+	{
+		V s = sources[lane];
+		if (visit[s] == 0)
+		{
+			levelVertices.emplace_back(s, 0);
+		}
+
+		visit[s] |= mask_t(1) << lane;
+		seen[s] |= mask_t(1) << lane;
+		sigma[s * lanes + lane] = 1;
+	}
+	for (auto& entry : levelVertices)
+	{
+		entry.second = visit[entry.first];
+	}
+
+	// Visit one level at a time for all lanes
+	while (levels.back() < levelVertices.size())
+	{
+		size_t levelBegin = levels.back();
+		size_t levelEnd = levelVertices.size();
+		levels.push_back(levelEnd);
+
+		// Discover vertices of next level for each lane reaching current level vertices
+		for (size_t i = levelBegin; i < levelEnd; ++i)
+		{
+			V v = levelVertices[i].first;
+
+			const auto fs = graph->forwardStar(v);
+			const V* fsVertices = fs.vertices();
+			for (size_t e = 0; e < fs.size(); ++e)
+			{
+				V w = fsVertices[e];
+				mask_t discovered = visit[v] & ~seen[w];
+
+				if (discovered)
+				{
+					if (visitNext[w] == 0)
+					{
+						levelVertices.emplace_back(w, 0);
+					}
+					visitNext[w] |= discovered;
+				}
+			}
+		}
+
+		// Count shortest paths of each lane through current level vertices
+		for (size_t i = levelBegin; i < levelEnd; ++i)
+		{
+			V v = levelVertices[i].first;
+
+			const auto fs = graph->forwardStar(v);
+			const V* fsVertices = fs.vertices();
+			for (size_t e = 0; e < fs.size(); ++e)
+			{
+				V w = fsVertices[e];
+				mask_t reached = visit[v] & visitNext[w];
+
+				while (reached)
+				{
+					size_t lane = __builtin_ctzll(reached);
+					sigma[w * lanes + lane] += sigma[v * lanes + lane];
+					reached &= reached - 1;
+				}
+			}
+		}
+
+		// Move frontier to next level
+		for (size_t i = levelBegin; i < levelEnd; ++i)
+		{
+			visit[levelVertices[i].first] = 0;
+		}
+		for (size_t i = levelEnd; i < levelVertices.size(); ++i)
+		{
+			V w = levelVertices[i].first;
+
+			levelVertices[i].second = visitNext[w];
+			seen[w] |= visitNext[w];
+			visit[w] = visitNext[w];
+			visitNext[w] = 0;
+		}
+	}
+
+	// Backward visit of each level, pulling dependency of each lane from its successors
+	for (size_t l = levels.size() - 1; l-- > 0;)
+	{
+		// Next level lanes of each vertex are needed to find successors
+		if (l + 3 < levels.size())
+		{
+			for (size_t i = levels[l + 2]; i < levels[l + 3]; ++i)
+			{
+				visit[levelVertices[i].first] = 0;
+			}
+		}
+		if (l + 2 < levels.size())
+		{
+			for (size_t i = levels[l + 1]; i < levels[l + 2]; ++i)
+			{
+				visit[levelVertices[i].first] = levelVertices[i].second;
+			}
+		}
+
+		for (size_t i = levels[l]; i < levels[l + 1]; ++i)
+		{
+			const auto& [v, lanesMask] = levelVertices[i];
+
+			const auto fs = graph->forwardStar(v);
+			const V* fsVertices = fs.vertices();
+			for (size_t e = 0; e < fs.size(); ++e)
+			{
+				V w = fsVertices[e];
+				mask_t successor = lanesMask & visit[w];
+
+				while (successor)
+				{
+					size_t lane = __builtin_ctzll(successor);
+					delta[v * lanes + lane] += sigma[v * lanes + lane] / sigma[w * lanes + lane] *
+						(1.0 + delta[w * lanes + lane]);
+					successor &= successor - 1;
+				}
+			}
+
+			// Sources are the only vertices of first level
+			if (l > 0)
+			{
+				mask_t reached = lanesMask;
+				while (reached)
+				{
+					size_t lane = __builtin_ctzll(reached);
+					bc[v] += delta[v * lanes + lane] * scales[lane];
+					reached &= reached - 1;
+				}
+			}
+		}
+	}
+
+	// Sparsely reset reached vertices
+	for (const auto& [v, lanesMask] : levelVertices)
+	{
+		seen[v] = 0;
+		visit[v] = 0;
+
+		mask_t reached = lanesMask;
+		while (reached)
+		{
+			size_t lane = __builtin_ctzll(reached);
+			sigma[v * lanes + lane] = 0;
+			delta[v * lanes + lane] = 0;
+			reached &= reached - 1;
+		}
+	}
+	levelVertices.clear();
+	levels.clear();
+}
+
+template<typename V, typename W>
+typename fastbc::brandes::MultiSourceBFSBrandesBC<V, W>::batch_workspace_t&
+fastbc::brandes::MultiSourceBFSBrandesBC<V, W>::_local(size_t vertexCount, size_t lanes)
+{
+	static thread_local batch_workspace_t workspace;
+
+	if (workspace.seen.size() != vertexCount || workspace.sigma.size() != vertexCount * lanes)
+	{
+		workspace.seen.assign(vertexCount, 0);
+		workspace.visit.assign(vertexCount, 0);
+		workspace.visitNext.assign(vertexCount, 0);
+		workspace.sigma.assign(vertexCount * lanes, 0);
+		workspace.delta.assign(vertexCount * lanes, 0);
+		workspace.levelVertices.clear();
+		workspace.levels.clear();
+	}
+
+	return workspace;
+}
+
+#endif
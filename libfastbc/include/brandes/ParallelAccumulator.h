@@ -0,0 +1,108 @@
+#ifndef FASTBC_BRANDES_PARALLELACCUMULATOR_H
+#define FASTBC_BRANDES_PARALLELACCUMULATOR_H
+
+#include <cstddef>
+#include <vector>
+
+#include <omp.h>
+
+namespace fastbc {
+	namespace brandes {
+
+		/**
+		 *	@brief Per-thread accumulation buffers merged once at the end of a computation
+		 *
+		 *	@details Replaces OpenMP array reductions, which allocate and zero a private copy
+		 *			 of the whole array for each thread at every parallel region. Each thread
+		 *			 allocates its own buffer on first use, so that only threads actually
+		 *			 accumulating pay for it and memory is first touched by its owner thread.
+		 *			 Buffers are kept for the whole object lifetime and can be used across
+		 *			 several parallel regions, then merged in parallel by blocks of indices.
+		 *
+		 *	@tparam W Type for accumulated value
+		 */
+		template<typename W>
+		class ParallelAccumulator
+		{
+		public:
+			/**
+			 *	@brief Initialize accumulation buffers of given size
+			 *
+			 *	@param size Number of values in each buffer
+			 */
+			ParallelAccumulator(size_t size);
+
+			/**
+			 *	@brief Get buffer of calling thread, allocating it on first call
+			 *
+			 *	@note Must be called by threads of the parallel region enclosing construction,
+			 *		  or of a parallel region not larger than omp_get_max_threads() when
+			 *		  constructed outside of any parallel region
+			 */
+			W* local();
+
+			/**
+			 *	@brief Sum all threads buffers to given array and reset them
+			 *
+			 *	@details Buffers are merged in parallel only outside of any parallel region
+			 *
+			 *	@param target Array of size values to sum accumulated values to
+			 */
+			void mergeInto(W* target);
+
+		private:
+			const size_t _size;
+			std::vector<std::vector<W>> _buffers;
+		};
+
+	}
+}
+
+template<typename W>
+fastbc::brandes::ParallelAccumulator<W>::ParallelAccumulator(size_t size)
+	: _size(size), _buffers(omp_in_parallel() ? omp_get_num_threads() : omp_get_max_threads())
+{
+}
+
+template<typename W>
+W* fastbc::brandes::ParallelAccumulator<W>::local()
+{
+	auto& buffer = _buffers[omp_get_thread_num()];
+	if (buffer.empty())
+	{
+		buffer.assign(_size, (W)0);
+	}
+
+	return buffer.data();
+}
+
+template<typename W>
+void fastbc::brandes::ParallelAccumulator<W>::mergeInto(W* target)
+{
+	// Only allocated buffers are merged
+	std::vector<W*> buffers;
+	for (auto& buffer : _buffers)
+	{
+		if (!buffer.empty())
+		{
+			buffers.push_back(buffer.data());
+		}
+	}
+
+	if (buffers.empty())
+	{
+		return;
+	}
+
+	#pragma omp parallel for schedule(static) if(!omp_in_parallel())
+	for (size_t i = 0; i < _size; ++i)
+	{
+		for (size_t b = 0; b < buffers.size(); ++b)
+		{
+			target[i] += buffers[b][i];
+			buffers[b][i] = 0;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,294 @@
+#ifndef FASTBC_BRANDES_PRUNEDBRANDESBC_H
+#define FASTBC_BRANDES_PRUNEDBRANDESBC_H
+
+#include "BFSSSBrandesBC.h"
+#include "DijkstraSSBrandesBC.h"
+#include "IBrandesBC.h"
+#include "ISSBrandesBC.h"
+#include "ParallelAccumulator.h"
+#include <CSRGraph.h>
+#include <EdgeWeights.h>
+#include <queue/BucketQueue.h>
+
+#include <algorithm>
+#include <memory>
+#include <spdlog/spdlog.h>
+#include <vector>
+
+namespace fastbc {
+	namespace brandes {
+
+		/**
+		 *	@brief Exact betweenness centrality computed on a graph pruned of its tree fringe
+		 *
+		 *	@details Vertices with a single neighbour, linked to it in both directions, are
+		 *			 removed iteratively, leaving trees hanging from the remaining core
+		 *			 vertices. Each core vertex is weighted by the size of its tree, and
+		 *			 weighted Brandes' dependencies are computed on the core graph only
+		 *			 (see ISSBrandesBC::accumulateWeightedBrandes). Shortest paths inside
+		 *			 a tree are unique, so BC of tree vertices is then reconstructed from
+		 *			 subtree sizes and the weight reached from and reaching their root.
+		 *			 Core graphs whose edges share the same weight are visited by breadth
+		 *			 first search, core graphs with small integer weights by Dijkstra's
+		 *			 algorithm with a bucket queue.
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for edge weight value
+		 */
+		template<typename V, typename W>
+		class PrunedBrandesBC : public IBrandesBC<V, W>
+		{
+		public:
+			/**
+			 *	@brief Initialize a pruned BC computer
+			 *
+			 *	@param ssb Single source Brandes computer used on core graphs with other weights
+			 */
+			PrunedBrandesBC(std::shared_ptr<ISSBrandesBC<V, W>> ssb);
+
+			std::vector<W> computeBC(const std::shared_ptr<const IGraph<V, W>> graph) override;
+
+		private:
+			std::shared_ptr<ISSBrandesBC<V, W>> _ssb;
+
+			/*
+			 *	@brief Remove tree fringe vertices, storing them in removal order with their parent
+			 */
+			void _prune(
+				const IGraph<V, W>& graph,
+				std::vector<V>& removalOrder,
+				std::vector<V>& parent,
+				std::vector<bool>& removed);
+		};
+
+	}
+}
+
+template<typename V, typename W>
+fastbc::brandes::PrunedBrandesBC<V, W>::PrunedBrandesBC(
+	std::shared_ptr<ISSBrandesBC<V, W>> ssb)
+	: _ssb(ssb)
+{
+}
+
+template<typename V, typename W>
+std::vector<W> fastbc::brandes::PrunedBrandesBC<V, W>::computeBC(
+	const std::shared_ptr<const IGraph<V, W>> graph)
+{
+	size_t vertexCount = graph->vertices().size();
+
+	std::vector<V> removalOrder;
+	std::vector<V> parent(vertexCount);
+	std::vector<bool> removed(vertexCount, false);
+	_prune(*graph, removalOrder, parent, removed);
+
+	SPDLOG_INFO("Pruned {} tree fringe vertices, {} core vertices left",
+		removalOrder.size(), vertexCount - removalOrder.size());
+
+	// Subtree sizes and sum of squared children subtree sizes, children are removed first
+	std::vector<W> subtree(vertexCount, 1);
+	std::vector<W> childrenSquares(vertexCount, 0);
+	for (V u : removalOrder)
+	{
+		subtree[parent[u]] += subtree[u];
+		childrenSquares[parent[u]] += subtree[u] * subtree[u];
+	}
+
+	// Core vertex each removed vertex hangs from, parents are removed last
+	std::vector<V> root(vertexCount);
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		root[v] = v;
+	}
+	for (auto it = removalOrder.rbegin(); it != removalOrder.rend(); ++it)
+	{
+		root[*it] = root[parent[*it]];
+	}
+
+	// Renumber core vertices and keep edges among them only
+	std::vector<V> rank(vertexCount);
+	std::vector<V> coreVertices;
+	coreVertices.reserve(vertexCount - removalOrder.size());
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		if (!removed[v])
+		{
+			rank[v] = coreVertices.size();
+			coreVertices.push_back(v);
+		}
+	}
+
+	std::vector<V> src;
+	std::vector<V> dest;
+	std::vector<W> weight;
+	for (V v : coreVertices)
+	{
+		const auto fs = graph->forwardStar(v);
+		for (size_t i = 0; i < fs.size(); ++i)
+		{
+			if (!removed[fs.vertex(i)])
+			{
+				src.push_back(rank[v]);
+				dest.push_back(rank[fs.vertex(i)]);
+				weight.push_back(fs.weight(i));
+			}
+		}
+	}
+
+	std::shared_ptr<const IGraph<V, W>> core =
+		std::make_shared<CSRGraph<V, W>>(std::move(src), std::move(dest), std::move(weight));
+
+	// Trailing isolated core vertices are not part of the core graph
+	size_t coreCount = core->vertices().size();
+	std::vector<W> vertexWeights(coreCount);
+	for (size_t c = 0; c < coreCount; ++c)
+	{
+		vertexWeights[c] = subtree[coreVertices[c]];
+	}
+
+	// Select single source computer by core graph edge weights
+	std::shared_ptr<ISSBrandesBC<V, W>> ssb = _ssb;
+	EdgeWeights<V, W> weights(*core);
+	if (weights.uniform())
+	{
+		SPDLOG_INFO("Uniform edge weights, computing shortest paths by breadth first search");
+		ssb = std::make_shared<BFSSSBrandesBC<V, W>>();
+	}
+	else if (useBucketQueue(weights))
+	{
+		ssb = std::make_shared<DijkstraSSBrandesBC<V, W, queue::BucketQueue<V, W>>>();
+	}
+
+	// Weight reached from and reaching each core vertex, outside its own tree
+	std::vector<W> coreBC(coreCount, 0);
+	std::vector<W> reach(coreCount, 0);
+	std::vector<W> inReach(coreCount, 0);
+	ParallelAccumulator<W> bcAccumulator(coreCount);
+	ParallelAccumulator<W> reachAccumulator(coreCount);
+
+	#pragma omp parallel
+	{
+		W* _coreBC = bcAccumulator.local();
+		W* _inReach = reachAccumulator.local();
+
+		#pragma omp for schedule(dynamic, 1)
+		for (size_t c = 0; c < coreCount; ++c)
+		{
+			reach[c] = ssb->accumulateWeightedBrandes(c, core, vertexWeights, 1, _coreBC, _inReach);
+		}
+	}
+
+	bcAccumulator.mergeInto(coreBC.data());
+	reachAccumulator.mergeInto(inReach.data());
+
+	// Add paths inside each tree, and paths between tree vertices below v and other trees
+	std::vector<W> bc(vertexCount);
+	#pragma omp parallel for
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		V r = root[v];
+		W treeSize = subtree[r];
+
+		// Ordered pairs of tree vertices other than v, lying in different components without v
+		W treeBC = (treeSize - 1) * (treeSize - 1) - childrenSquares[v];
+		if (removed[v])
+		{
+			treeBC -= (treeSize - subtree[v]) * (treeSize - subtree[v]);
+		}
+
+		if (!removed[v])
+		{
+			bc[v] = treeBC + ((size_t)rank[v] < coreCount ? coreBC[rank[v]] : 0);
+		}
+		else if ((size_t)rank[r] < coreCount)
+		{
+			bc[v] = treeBC + (subtree[v] - 1) * (reach[rank[r]] + inReach[rank[r]]);
+		}
+		else
+		{
+			bc[v] = treeBC;
+		}
+	}
+
+	return bc;
+}
+
+template<typename V, typename W>
+void fastbc::brandes::PrunedBrandesBC<V, W>::_prune(
+	const IGraph<V, W>& graph,
+	std::vector<V>& removalOrder,
+	std::vector<V>& parent,
+	std::vector<bool>& removed)
+{
+	size_t vertexCount = graph.vertices().size();
+
+	// Number of distinct neighbours of each vertex, in either direction
+	std::vector<size_t> degree(vertexCount);
+	#pragma omp parallel
+	{
+		std::vector<V> neighbours;
+
+		#pragma omp for schedule(dynamic, 1024)
+		for (size_t v = 0; v < vertexCount; ++v)
+		{
+			const auto fs = graph.forwardStar(v);
+			const auto bs = graph.backwardStar(v);
+			neighbours.assign(fs.vertices(), fs.vertices() + fs.size());
+			neighbours.insert(neighbours.end(), bs.vertices(), bs.vertices() + bs.size());
+
+			std::sort(neighbours.begin(), neighbours.end());
+			neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+			degree[v] = neighbours.size() - std::binary_search(neighbours.begin(), neighbours.end(), (V)v);
+		}
+	}
+
+	std::vector<V> candidates;
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		if (degree[v] == 1)
+		{
+			candidates.push_back(v);
+		}
+	}
+
+	while (!candidates.empty())
+	{
+		V u = candidates.back();
+		candidates.pop_back();
+
+		// A vertex is met again only once its degree has dropped
+		if (removed[u] || degree[u] != 1)
+		{
+			continue;
+		}
+
+		// Find remaining neighbour, which must be linked to u in both directions
+		const auto fs = graph.forwardStar(u);
+		const auto bs = graph.backwardStar(u);
+		if (fs.find(u) != fs.end())
+		{
+			continue;
+		}
+
+		V a = u;
+		for (size_t i = 0; i < fs.size() && a == u; ++i)
+		{
+			a = removed[fs.vertex(i)] ? u : fs.vertex(i);
+		}
+		if (a == u || bs.find(a) == bs.end())
+		{
+			continue;
+		}
+
+		removed[u] = true;
+		parent[u] = a;
+		removalOrder.push_back(u);
+
+		if (--degree[a] == 1)
+		{
+			candidates.push_back(a);
+		}
+	}
+}
+
+#endif
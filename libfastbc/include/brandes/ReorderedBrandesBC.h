@@ -0,0 +1,116 @@
+#ifndef FASTBC_BRANDES_REORDEREDBRANDESBC_H
+#define FASTBC_BRANDES_REORDEREDBRANDESBC_H
+
+#include "IBrandesBC.h"
+#include <CSRGraph.h>
+#include <reorder/IVertexOrdering.h>
+
+#include <memory>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+#include <vector>
+
+namespace fastbc {
+	namespace brandes {
+
+		/**
+		 *	@brief Betweenness centrality computed on a graph with reordered vertices
+		 *
+		 *	@details Graph vertices are renumbered with given ordering to improve memory
+		 *			 locality of per-vertex data, BC is computed on the renumbered graph
+		 *			 and mapped back to original vertex indices.
+		 */
+		template<typename V, typename W>
+		class ReorderedBrandesBC : public IBrandesBC<V, W>
+		{
+		public:
+			/**
+			 *	@brief Initialize a reordered BC computer
+			 *
+			 *	@param ordering Vertices ordering to apply
+			 *	@param brandesBC BC computer to run on reordered graph
+			 */
+			ReorderedBrandesBC(
+				std::shared_ptr<reorder::IVertexOrdering<V, W>> ordering,
+				std::shared_ptr<IBrandesBC<V, W>> brandesBC);
+
+			std::vector<W> computeBC(const std::shared_ptr<const IGraph<V, W>> graph) override;
+
+		private:
+			std::shared_ptr<reorder::IVertexOrdering<V, W>> _ordering;
+			std::shared_ptr<IBrandesBC<V, W>> _brandesBC;
+		};
+
+	}
+}
+
+template<typename V, typename W>
+fastbc::brandes::ReorderedBrandesBC<V, W>::ReorderedBrandesBC(
+	std::shared_ptr<reorder::IVertexOrdering<V, W>> ordering,
+	std::shared_ptr<IBrandesBC<V, W>> brandesBC)
+	: _ordering(ordering), _brandesBC(brandesBC)
+{
+}
+
+template<typename V, typename W>
+std::vector<W> fastbc::brandes::ReorderedBrandesBC<V, W>::computeBC(
+	const std::shared_ptr<const IGraph<V, W>> graph)
+{
+	size_t vertexCount = graph->vertices().size();
+
+	SPDLOG_INFO("Reordering graph vertices...");
+	std::vector<V> order = _ordering->computeOrder(graph);
+	if (order.size() != vertexCount)
+	{
+		throw std::invalid_argument("Computed vertices order is not a permutation of graph vertices");
+	}
+
+	// New index of each original vertex
+	std::vector<V> rank(vertexCount);
+	#pragma omp parallel for
+	for (size_t i = 0; i < vertexCount; ++i)
+	{
+		rank[order[i]] = i;
+	}
+
+	// Renumber every edge of the graph
+	std::vector<size_t> edgeOffset(vertexCount + 1, 0);
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		edgeOffset[v + 1] = edgeOffset[v] + graph->forwardStar(v).size();
+	}
+
+	std::vector<V> src(edgeOffset.back());
+	std::vector<V> dest(edgeOffset.back());
+	std::vector<W> weight(edgeOffset.back());
+	#pragma omp parallel for schedule(dynamic, 1024)
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		const auto fs = graph->forwardStar(v);
+		for (size_t i = 0; i < fs.size(); ++i)
+		{
+			src[edgeOffset[v] + i] = rank[v];
+			dest[edgeOffset[v] + i] = rank[fs.vertex(i)];
+			weight[edgeOffset[v] + i] = fs.weight(i);
+		}
+	}
+
+	std::shared_ptr<const IGraph<V, W>> reordered =
+		std::make_shared<CSRGraph<V, W>>(std::move(src), std::move(dest), std::move(weight));
+	_ordering->orderApplied(reordered);
+
+	std::vector<W> reorderedBC = _brandesBC->computeBC(reordered);
+
+	// Map BC back to original vertex indices
+	std::vector<W> bc(vertexCount);
+	#pragma omp parallel for
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		// Trailing isolated vertices are not part of the renumbered graph
+		bc[v] = (size_t)rank[v] < reorderedBC.size() ? reorderedBC[rank[v]] : 0;
+	}
+
+	return bc;
+}
+
+#endif
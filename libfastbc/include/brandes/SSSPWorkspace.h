@@ -0,0 +1,128 @@
+#ifndef FASTBC_BRANDES_SSSPWORKSPACE_H
+#define FASTBC_BRANDES_SSSPWORKSPACE_H
+
+#include <queue/DefaultQueue.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace fastbc {
+	namespace brandes {
+
+		/**
+		 *	@brief Reusable storage for single source shortest paths and dependency computation
+		 *
+		 *	@details Buffers are sized on the graph vertices count once and reused by
+		 *			 following computations on the same thread. Only vertices reached by
+		 *			 last computation, which are listed in the visit stack, are reset
+		 *			 between sources, so that reset cost is proportional to the visited
+		 *			 portion of the graph instead of to its size.
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for edge weight value
+		 *	@tparam Queue Priority queue policy used to visit vertices
+		 */
+		template<typename V, typename W, typename Queue = queue::DefaultQueue<V, W>>
+		class SSSPWorkspace
+		{
+		public:
+
+			/**
+			 *	@brief Get workspace of calling thread
+			 *
+			 *	@note Workspace memory is kept until calling thread terminates
+			 */
+			static SSSPWorkspace& local();
+
+			/**
+			 *	@brief Prepare workspace for a new computation on a graph with given vertices count
+			 *
+			 *	@details All distances are set to infinity, path counts, dependencies,
+			 *			 predecessors lists and visit queue are empty. A full reset is done
+			 *			 only when vertices count changed or last computation has not been released.
+			 *
+			 *	@param vertexCount Number of graph vertices
+			 */
+			void prepare(size_t vertexCount);
+
+			/**
+			 *	@brief Sparsely reset entries of vertices in visit stack and release workspace
+			 */
+			void release();
+
+			// Distance from source of each vertex
+			std::vector<W> dist;
+
+			// Shortest paths count from source to each vertex
+			std::vector<W> sigma;
+
+			// Partial dependency of source on each vertex
+			std::vector<W> delta;
+
+			// First entry of the shortest paths predecessors list of each vertex
+			std::vector<size_t> spPredHead;
+
+			// Shortest paths predecessors lists entries: predecessor and next entry
+			std::vector<std::pair<V, size_t>> spPred;
+
+			// Vertices in non-decreasing distance from source order
+			std::vector<V> visitStack;
+
+			// Vertices to visit, by distance from source
+			Queue visitQueue;
+
+			// End of predecessors list marker
+			static constexpr size_t none = std::numeric_limits<size_t>::max();
+
+		private:
+			bool _dirty = false;
+		};
+
+	}
+}
+
+template<typename V, typename W, typename Queue>
+fastbc::brandes::SSSPWorkspace<V, W, Queue>& fastbc::brandes::SSSPWorkspace<V, W, Queue>::local()
+{
+	static thread_local SSSPWorkspace<V, W, Queue> workspace;
+
+	return workspace;
+}
+
+template<typename V, typename W, typename Queue>
+void fastbc::brandes::SSSPWorkspace<V, W, Queue>::prepare(size_t vertexCount)
+{
+	if (_dirty || dist.size() != vertexCount)
+	{
+		dist.assign(vertexCount, std::numeric_limits<W>::max());
+		sigma.assign(vertexCount, 0);
+		delta.assign(vertexCount, 0);
+		spPredHead.assign(vertexCount, none);
+		spPred.clear();
+		visitStack.clear();
+		visitQueue.reserve(vertexCount);
+	}
+
+	_dirty = true;
+}
+
+template<typename V, typename W, typename Queue>
+void fastbc::brandes::SSSPWorkspace<V, W, Queue>::release()
+{
+	for (const auto& v : visitStack)
+	{
+		dist[v] = std::numeric_limits<W>::max();
+		sigma[v] = 0;
+		delta[v] = 0;
+		spPredHead[v] = none;
+	}
+	spPred.clear();
+	visitStack.clear();
+
+	_dirty = false;
+}
+
+#endif
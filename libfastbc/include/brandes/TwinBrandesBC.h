@@ -0,0 +1,393 @@
+#ifndef FASTBC_BRANDES_TWINBRANDESBC_H
+#define FASTBC_BRANDES_TWINBRANDESBC_H
+
+#include "ExactBrandesBC.h"
+#include "IBrandesBC.h"
+#include "ParallelAccumulator.h"
+#include "SSSPWorkspace.h"
+#include <CSRGraph.h>
+#include <EdgeWeights.h>
+#include <queue/BucketQueue.h>
+#include <queue/DefaultQueue.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <spdlog/spdlog.h>
+#include <utility>
+#include <vector>
+
+namespace fastbc {
+	namespace brandes {
+
+		/**
+		 *	@brief Exact Brandes' betweenness centrality computed on a graph with structural
+		 *		   twin vertices merged
+		 *
+		 *	@details Twin vertices have the same forward and backward stars, with the same
+		 *			 weights, and share shortest paths DAGs and BC. Vertices are grouped by a
+		 *			 hash of their stars, each group of twins is replaced by a representative
+		 *			 vertex with the group size as multiplicity, and BC is computed from
+		 *			 representatives only: shortest paths through a representative are
+		 *			 counted once per twin, each representative is a target once per twin,
+		 *			 and dependencies are summed once per twin of the source. Paths between
+		 *			 twins are the shortest cycles through their representative. Group BC
+		 *			 is then split evenly among twins.
+		 *			 Graphs without twins are computed by ExactBrandesBC.
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for edge weight value
+		 *	@tparam Queue Priority queue policy used by Dijkstra's algorithm (see queue::SetQueue)
+		 */
+		template<typename V, typename W, typename Queue = queue::DefaultQueue<V, W>>
+		class TwinBrandesBC : public IBrandesBC<V, W>
+		{
+		public:
+			std::vector<W> computeBC(const std::shared_ptr<const IGraph<V, W>> graph) override;
+
+		private:
+
+			/*
+			 *	@brief Compute representative index of each vertex twins group
+			 */
+			size_t _twins(const IGraph<V, W>& graph, std::vector<V>& group);
+
+			template<typename Q>
+			std::vector<W> _brandes(
+				std::shared_ptr<const IGraph<V, W>> graph,
+				const std::vector<W>& multiplicity);
+
+			template<typename Q>
+			void _dijkstra_SSSP(
+				V src,
+				std::shared_ptr<const IGraph<V, W>> graph,
+				const std::vector<W>& multiplicity,
+				SSSPWorkspace<V, W, Q>& workspace);
+		};
+
+	}
+}
+
+template<typename V, typename W, typename Queue>
+std::vector<W> fastbc::brandes::TwinBrandesBC<V, W, Queue>::computeBC(
+	const std::shared_ptr<const IGraph<V, W>> graph)
+{
+	size_t vertexCount = graph->vertices().size();
+
+	std::vector<V> group;
+	size_t groupCount = _twins(*graph, group);
+
+	SPDLOG_INFO("Merged {} twin vertices, {} vertices left", vertexCount - groupCount, groupCount);
+
+	if (groupCount == vertexCount)
+	{
+		return ExactBrandesBC<V, W, Queue>().computeBC(graph);
+	}
+
+	// Keep edges among representatives, others are parallel to them
+	std::vector<W> multiplicity(groupCount, 0);
+	std::vector<bool> representative(vertexCount, false);
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		representative[v] = multiplicity[group[v]] == 0;
+		multiplicity[group[v]] += 1;
+	}
+
+	std::vector<V> src;
+	std::vector<V> dest;
+	std::vector<W> weight;
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		if (!representative[v])
+		{
+			continue;
+		}
+
+		const auto fs = graph->forwardStar(v);
+		for (size_t i = 0; i < fs.size(); ++i)
+		{
+			if (representative[fs.vertex(i)])
+			{
+				src.push_back(group[v]);
+				dest.push_back(group[fs.vertex(i)]);
+				weight.push_back(fs.weight(i));
+			}
+		}
+	}
+
+	std::shared_ptr<const IGraph<V, W>> merged =
+		std::make_shared<CSRGraph<V, W>>(std::move(src), std::move(dest), std::move(weight));
+
+	std::vector<W> groupBC = useBucketQueue<Queue>(EdgeWeights<V, W>(*merged)) ?
+		_brandes<queue::BucketQueue<V, W>>(merged, multiplicity) :
+		_brandes<Queue>(merged, multiplicity);
+
+	// Twins share group BC evenly
+	std::vector<W> bc(vertexCount);
+	#pragma omp parallel for
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		bc[v] = groupBC[group[v]] / multiplicity[group[v]];
+	}
+
+	return bc;
+}
+
+template<typename V, typename W, typename Queue>
+size_t fastbc::brandes::TwinBrandesBC<V, W, Queue>::_twins(
+	const IGraph<V, W>& graph,
+	std::vector<V>& group)
+{
+	size_t vertexCount = graph.vertices().size();
+
+	// Hash forward and backward stars of each vertex
+	std::vector<std::pair<size_t, V>> hashes(vertexCount);
+	#pragma omp parallel for schedule(dynamic, 1024)
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		size_t hash = 0;
+		for (const auto& star : { graph.forwardStar(v), graph.backwardStar(v) })
+		{
+			hash = hash * 31 + star.size();
+			for (size_t i = 0; i < star.size(); ++i)
+			{
+				hash = hash * 1000003 ^ std::hash<V>()(star.vertex(i));
+				hash = hash * 1000003 ^ std::hash<W>()(star.weight(i));
+			}
+		}
+		hashes[v] = std::make_pair(hash, v);
+	}
+
+	std::sort(hashes.begin(), hashes.end());
+
+	auto sameStar = [](const Star<V, W>& s1, const Star<V, W>& s2)
+	{
+		return s1.size() == s2.size() &&
+			std::equal(s1.vertices(), s1.vertices() + s1.size(), s2.vertices()) &&
+			std::equal(s1.weights(), s1.weights() + s1.size(), s2.weights());
+	};
+
+	// Vertices with equal hash are compared to the twins groups found so far in their run
+	group.assign(vertexCount, 0);
+	std::vector<V> runRepresentatives;
+	std::vector<V> representatives;
+	for (size_t i = 0; i < vertexCount; ++i)
+	{
+		if (i == 0 || hashes[i].first != hashes[i - 1].first)
+		{
+			runRepresentatives.clear();
+		}
+
+		V v = hashes[i].second;
+		const auto fs = graph.forwardStar(v);
+		const auto bs = graph.backwardStar(v);
+
+		// Vertices with a self loop have no twin
+		V twin = v;
+		if (fs.find(v) == fs.end())
+		{
+			for (V r : runRepresentatives)
+			{
+				if (sameStar(fs, graph.forwardStar(r)) && sameStar(bs, graph.backwardStar(r)))
+				{
+					twin = r;
+					break;
+				}
+			}
+		}
+
+		if (twin == v)
+		{
+			runRepresentatives.push_back(v);
+			representatives.push_back(v);
+		}
+		group[v] = twin;
+	}
+
+	// Number groups in order of their smallest vertex, which is their representative
+	std::vector<V> first(vertexCount, vertexCount);
+	for (V r : representatives)
+	{
+		first[r] = r;
+	}
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		first[group[v]] = std::min(first[group[v]], (V)v);
+	}
+
+	std::vector<V> groupIndex(vertexCount, 0);
+	size_t groupCount = 0;
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		if (first[group[v]] == (V)v)
+		{
+			groupIndex[group[v]] = groupCount++;
+		}
+	}
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		group[v] = groupIndex[group[v]];
+	}
+
+	return groupCount;
+}
+
+template<typename V, typename W, typename Queue>
+template<typename Q>
+std::vector<W> fastbc::brandes::TwinBrandesBC<V, W, Queue>::_brandes(
+	std::shared_ptr<const IGraph<V, W>> graph,
+	const std::vector<W>& multiplicity)
+{
+	size_t groupCount = multiplicity.size();
+	size_t graphSize = graph->vertices().size();
+
+	std::vector<W> groupBC(groupCount, (W)0);
+	ParallelAccumulator<W> accumulator(groupCount);
+
+	#pragma omp parallel
+	{
+		W* _groupBC = accumulator.local();
+
+		SSSPWorkspace<V, W, Q>& workspace = SSSPWorkspace<V, W, Q>::local();
+		const auto& visitStack = workspace.visitStack;
+		const auto& dist = workspace.dist;
+		const auto& sigma = workspace.sigma;
+		auto& delta = workspace.delta;
+
+		// Trailing isolated groups are not part of the merged graph
+		#pragma omp for schedule(dynamic, 1)
+		for (size_t s = 0; s < graphSize; ++s)
+		{
+			workspace.prepare(groupCount);
+
+			_dijkstra_SSSP(s, graph, multiplicity, workspace);
+
+			// Paths reaching any twin of v, counted once from the source
+			auto paths = [&](V v) { return (size_t)v == s ? (W)1 : sigma[v] * multiplicity[v]; };
+
+			// Paths to the other twins of the source are the shortest cycles through it
+			if (multiplicity[s] > 1)
+			{
+				const auto bs = graph->backwardStar(s);
+				W cycleDist = std::numeric_limits<W>::max();
+				W cycleSigma = 0;
+				for (size_t i = 0; i < bs.size(); ++i)
+				{
+					V y = bs.vertex(i);
+					if (dist[y] == std::numeric_limits<W>::max())
+					{
+						continue;
+					}
+
+					W yDist = dist[y] + bs.weight(i);
+					if (yDist < cycleDist)
+					{
+						cycleDist = yDist;
+						cycleSigma = 0;
+					}
+					if (yDist == cycleDist)
+					{
+						cycleSigma += paths(y);
+					}
+				}
+
+				for (size_t i = 0; i < bs.size(); ++i)
+				{
+					V y = bs.vertex(i);
+					if (dist[y] != std::numeric_limits<W>::max() && dist[y] + bs.weight(i) == cycleDist)
+					{
+						delta[y] += paths(y) / cycleSigma * (multiplicity[s] - 1);
+					}
+				}
+			}
+
+			// Backward visit of each vertex, pulling dependency from its successors
+			for (auto it = visitStack.rbegin(); it != visitStack.rend(); ++it)
+			{
+				V v = *it;
+
+				const auto fs = graph->forwardStar(v);
+				const V* fsVertices = fs.vertices();
+				const W* fsWeights = fs.weights();
+				for (size_t i = 0; i < fs.size(); ++i)
+				{
+					V w = fsVertices[i];
+					if (dist[v] + fsWeights[i] == dist[w])
+					{
+						delta[v] += paths(v) / sigma[w] * (multiplicity[w] + delta[w]);
+					}
+				}
+
+				if ((size_t)v != s)
+				{
+					_groupBC[v] += delta[v] * multiplicity[s];
+				}
+			}
+
+			workspace.release();
+		}
+	}
+
+	accumulator.mergeInto(groupBC.data());
+
+	return groupBC;
+}
+
+template<typename V, typename W, typename Queue>
+template<typename Q>
+void fastbc::brandes::TwinBrandesBC<V, W, Queue>::_dijkstra_SSSP(
+	V src,
+	std::shared_ptr<const IGraph<V, W>> graph,
+	const std::vector<W>& multiplicity,
+	SSSPWorkspace<V, W, Q>& workspace)
+{
+	auto& visitStack = workspace.visitStack;
+	auto& dist = workspace.dist;
+	auto& sigma = workspace.sigma;
+	auto& visitQueue = workspace.visitQueue;
+
+	sigma[src] = 1;
+	dist[src] = 0;
+	visitQueue.push(src, 0);
+
+	while (!visitQueue.empty())
+	{
+		V v = visitQueue.pop();
+		visitStack.push_back(v);
+
+		// Each path to v continues from any of its twins
+		W vPaths = v == src ? 1 : sigma[v] * multiplicity[v];
+
+		const auto fs = graph->forwardStar(v);
+		const V* fsVertices = fs.vertices();
+		const W* fsWeights = fs.weights();
+		for (size_t i = 0; i < fs.size(); ++i)
+		{
+			V w = fsVertices[i];
+			W newDist = dist[v] + fsWeights[i];
+
+			if (newDist < dist[w])
+			{
+				if (dist[w] == std::numeric_limits<W>::max())
+				{
+					visitQueue.push(w, newDist);
+				}
+				else
+				{
+					visitQueue.decrease(w, newDist);
+				}
+				dist[w] = newDist;
+				sigma[w] = 0;
+			}
+
+			if (newDist == dist[w])
+			{
+				sigma[w] += vPaths;
+			}
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,398 @@
+#ifndef FASTBC_BRANDES_VERTEXINFOMATRIX_H
+#define FASTBC_BRANDES_VERTEXINFOMATRIX_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+namespace fastbc {
+	namespace brandes {
+
+		/**
+		 *	@brief Topological information of all vertices of a cluster
+		 *
+		 *	@details Shortest path lengths and counts from each cluster vertex (row) to
+		 *			 each cluster border (column) are stored in two dense matrices, with
+		 *			 rows padded and aligned to cache lines. A cluster is described by
+		 *			 two allocations instead of a pair of vectors per vertex, and row
+		 *			 operations run on contiguous aligned arrays, so that they can be
+		 *			 vectorized. Rows are addressed by vertex position in cluster vertices.
+		 *
+		 *	@tparam V Type for shortest paths count
+		 *	@tparam W Type for shortest paths length
+		 */
+		template<typename V, typename W>
+		class VertexInfoMatrix
+		{
+		public:
+			// Alignment of each row, in bytes
+			static constexpr size_t alignment = 64;
+
+			/**
+			 *	@brief Initialize an empty matrix
+			 */
+			VertexInfoMatrix();
+
+			/**
+			 *	@brief Initialize a matrix of rowCount rows of borderCount zero lengths and counts
+			 *
+			 *	@param rowCount Number of vertices
+			 *	@param borderCount Number of borders
+			 */
+			VertexInfoMatrix(size_t rowCount, int borderCount);
+
+			/**
+			 *	@brief Get number of rows
+			 */
+			size_t rows() const;
+
+			/**
+			 *	@brief Get number of borders of each row
+			 */
+			int borders() const;
+
+			/**
+			 *	@brief Get SP lengths of given row, one per border
+			 */
+			W* lengths(size_t row);
+			const W* lengths(size_t row) const;
+
+			/**
+			 *	@brief Get SP counts of given row, one per border
+			 */
+			V* counts(size_t row);
+			const V* counts(size_t row) const;
+
+			/**
+			 *	@brief Get minimum SP length of given row among all borders
+			 */
+			W getMinBorderSPLength(size_t row) const;
+
+			/**
+			 *	@brief Subtract minimum SP length of given row from each of its SP lengths
+			 */
+			void normalize(size_t row);
+
+			/**
+			 *	@brief Round SP lengths of given row to the nearest multiple of quantum
+			 */
+			void quantize(size_t row, W quantum);
+
+			/**
+			 *	@brief Get maximum SP length of given row among all borders
+			 */
+			W getMaxBorderSPLength(size_t row) const;
+
+			/**
+			 *	@brief Reset all SP lengths and counts to zero
+			 */
+			void reset();
+
+			/**
+			 *	@brief Compute euclidean distance between given rows SP lengths and counts
+			 *
+			 *	@param row Row of this matrix
+			 *	@param other Matrix with the same number of borders
+			 *	@param otherRow Row of other matrix
+			 */
+			template<typename N, typename E>
+			W squaredDistance(size_t row, const VertexInfoMatrix<N, E>& other, size_t otherRow) const;
+
+			/**
+			 *	@brief Compare given rows of this matrix, border by border, by SP count then length
+			 *
+			 *	@return W Zero when rows are equal, first non-zero difference otherwise
+			 */
+			W compare(size_t row, size_t otherRow) const;
+
+			/**
+			 *	@brief Hash SP lengths and counts of given row, rows comparing equal have the same hash
+			 */
+			size_t hash(size_t row) const;
+
+			/**
+			 *	@brief Sum given row of other matrix to given row
+			 */
+			template<typename N, typename E>
+			void add(size_t row, const VertexInfoMatrix<N, E>& other, size_t otherRow);
+
+			/**
+			 *	@brief Divide SP lengths and counts of given row by num
+			 */
+			template<typename T>
+			void divide(size_t row, T num);
+
+		private:
+			/*
+			 *	@brief Allocator of cache line aligned buffers
+			 */
+			template<typename T>
+			struct aligned_allocator_t
+			{
+				using value_type = T;
+
+				aligned_allocator_t() = default;
+
+				template<typename U>
+				aligned_allocator_t(const aligned_allocator_t<U>&) {}
+
+				T* allocate(size_t n)
+				{
+					return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignment)));
+				}
+
+				void deallocate(T* p, size_t)
+				{
+					::operator delete(p, std::align_val_t(alignment));
+				}
+
+				template<typename U>
+				bool operator==(const aligned_allocator_t<U>&) const { return true; }
+
+				template<typename U>
+				bool operator!=(const aligned_allocator_t<U>&) const { return false; }
+			};
+
+			// Number of values of given size filling whole cache lines, and at least count
+			static size_t _stride(size_t count, size_t size);
+
+			size_t _rowCount;
+			int _borderCount;
+			size_t _lengthStride;
+			size_t _countStride;
+			std::vector<W, aligned_allocator_t<W>> _lengths;
+			std::vector<V, aligned_allocator_t<V>> _counts;
+
+			template<typename N, typename E>
+			friend class VertexInfoMatrix;
+		};
+
+	}
+}
+
+template<typename V, typename W>
+fastbc::brandes::VertexInfoMatrix<V, W>::VertexInfoMatrix()
+	: VertexInfoMatrix(0, 0)
+{
+}
+
+template<typename V, typename W>
+fastbc::brandes::VertexInfoMatrix<V, W>::VertexInfoMatrix(size_t rowCount, int borderCount)
+	: _rowCount(rowCount),
+	_borderCount(borderCount),
+	_lengthStride(_stride(borderCount, sizeof(W))),
+	_countStride(_stride(borderCount, sizeof(V))),
+	_lengths(rowCount * _lengthStride, (W)0),
+	_counts(rowCount * _countStride, (V)0)
+{
+	if (borderCount < 0)
+	{
+		throw std::invalid_argument("Negative border count.");
+	}
+}
+
+template<typename V, typename W>
+size_t fastbc::brandes::VertexInfoMatrix<V, W>::rows() const
+{
+	return _rowCount;
+}
+
+template<typename V, typename W>
+int fastbc::brandes::VertexInfoMatrix<V, W>::borders() const
+{
+	return _borderCount;
+}
+
+template<typename V, typename W>
+W* fastbc::brandes::VertexInfoMatrix<V, W>::lengths(size_t row)
+{
+	return _lengths.data() + row * _lengthStride;
+}
+
+template<typename V, typename W>
+const W* fastbc::brandes::VertexInfoMatrix<V, W>::lengths(size_t row) const
+{
+	return _lengths.data() + row * _lengthStride;
+}
+
+template<typename V, typename W>
+V* fastbc::brandes::VertexInfoMatrix<V, W>::counts(size_t row)
+{
+	return _counts.data() + row * _countStride;
+}
+
+template<typename V, typename W>
+const V* fastbc::brandes::VertexInfoMatrix<V, W>::counts(size_t row) const
+{
+	return _counts.data() + row * _countStride;
+}
+
+template<typename V, typename W>
+W fastbc::brandes::VertexInfoMatrix<V, W>::getMinBorderSPLength(size_t row) const
+{
+	// It could be possible to have a sub-graph not connected to external vertices
+	if (!_borderCount) { return 0; }
+
+	const W* rowLengths = lengths(row);
+	return *std::min_element(rowLengths, rowLengths + _borderCount);
+}
+
+template<typename V, typename W>
+void fastbc::brandes::VertexInfoMatrix<V, W>::normalize(size_t row)
+{
+	W min = getMinBorderSPLength(row);
+	W* rowLengths = lengths(row);
+
+	#pragma omp simd aligned(rowLengths:alignment)
+	for (int i = 0; i < _borderCount; ++i)
+	{
+		rowLengths[i] -= min;
+	}
+}
+
+template<typename V, typename W>
+void fastbc::brandes::VertexInfoMatrix<V, W>::quantize(size_t row, W quantum)
+{
+	W* rowLengths = lengths(row);
+
+	#pragma omp simd aligned(rowLengths:alignment)
+	for (int i = 0; i < _borderCount; ++i)
+	{
+		rowLengths[i] = std::round(rowLengths[i] / quantum) * quantum;
+	}
+}
+
+template<typename V, typename W>
+W fastbc::brandes::VertexInfoMatrix<V, W>::getMaxBorderSPLength(size_t row) const
+{
+	if (!_borderCount) { return 0; }
+
+	const W* rowLengths = lengths(row);
+	return *std::max_element(rowLengths, rowLengths + _borderCount);
+}
+
+template<typename V, typename W>
+void fastbc::brandes::VertexInfoMatrix<V, W>::reset()
+{
+	std::fill(_lengths.begin(), _lengths.end(), (W)0);
+	std::fill(_counts.begin(), _counts.end(), (V)0);
+}
+
+template<typename V, typename W>
+template<typename N, typename E>
+W fastbc::brandes::VertexInfoMatrix<V, W>::squaredDistance(
+	size_t row,
+	const VertexInfoMatrix<N, E>& other,
+	size_t otherRow) const
+{
+	const W* rowLengths = lengths(row);
+	const V* rowCounts = counts(row);
+	const E* otherLengths = other.lengths(otherRow);
+	const N* otherCounts = other.counts(otherRow);
+
+	W sqDistance = 0;
+
+	#pragma omp simd reduction(+:sqDistance) aligned(rowLengths, rowCounts, otherLengths, otherCounts:alignment)
+	for (int i = 0; i < _borderCount; ++i)
+	{
+		W length = rowLengths[i] - (W)otherLengths[i];
+		W count = (W)rowCounts[i] - (W)otherCounts[i];
+		sqDistance += length * length + count * count;
+	}
+
+	return sqDistance;
+}
+
+template<typename V, typename W>
+W fastbc::brandes::VertexInfoMatrix<V, W>::compare(size_t row, size_t otherRow) const
+{
+	const W* rowLengths = lengths(row);
+	const V* rowCounts = counts(row);
+	const W* otherLengths = lengths(otherRow);
+	const V* otherCounts = counts(otherRow);
+
+	for (int i = 0; i < _borderCount; ++i)
+	{
+		if (W cmp = rowCounts[i] - otherCounts[i]; cmp != 0)
+		{
+			return cmp;
+		}
+
+		if (W cmp = rowLengths[i] - otherLengths[i]; cmp != 0)
+		{
+			return cmp;
+		}
+	}
+
+	return 0;
+}
+
+template<typename V, typename W>
+size_t fastbc::brandes::VertexInfoMatrix<V, W>::hash(size_t row) const
+{
+	const W* rowLengths = lengths(row);
+	const V* rowCounts = counts(row);
+
+	size_t seed = _borderCount;
+	auto combine = [&seed](size_t h)
+	{
+		seed ^= h + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+	};
+
+	for (int i = 0; i < _borderCount; ++i)
+	{
+		combine(std::hash<V>()(rowCounts[i]));
+		combine(std::hash<W>()(rowLengths[i]));
+	}
+
+	return seed;
+}
+
+template<typename V, typename W>
+template<typename N, typename E>
+void fastbc::brandes::VertexInfoMatrix<V, W>::add(
+	size_t row,
+	const VertexInfoMatrix<N, E>& other,
+	size_t otherRow)
+{
+	W* rowLengths = lengths(row);
+	V* rowCounts = counts(row);
+	const E* otherLengths = other.lengths(otherRow);
+	const N* otherCounts = other.counts(otherRow);
+
+	#pragma omp simd aligned(rowLengths, rowCounts, otherLengths, otherCounts:alignment)
+	for (int i = 0; i < _borderCount; ++i)
+	{
+		rowLengths[i] += otherLengths[i];
+		rowCounts[i] += otherCounts[i];
+	}
+}
+
+template<typename V, typename W>
+template<typename T>
+void fastbc::brandes::VertexInfoMatrix<V, W>::divide(size_t row, T num)
+{
+	W* rowLengths = lengths(row);
+	V* rowCounts = counts(row);
+
+	#pragma omp simd aligned(rowLengths, rowCounts:alignment)
+	for (int i = 0; i < _borderCount; ++i)
+	{
+		rowLengths[i] /= num;
+		rowCounts[i] /= num;
+	}
+}
+
+template<typename V, typename W>
+size_t fastbc::brandes::VertexInfoMatrix<V, W>::_stride(size_t count, size_t size)
+{
+	size_t lineValues = std::max(alignment / size, (size_t)1);
+
+	return (count + lineValues - 1) / lineValues * lineValues;
+}
+
+#endif
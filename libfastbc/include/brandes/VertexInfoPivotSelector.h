@@ -3,10 +3,15 @@
 
 #include "IPivotSelector.h"
 
+#include <algorithm>
 #include <memory>
 #include <spdlog/spdlog.h>
+#include <stdexcept>
+#include <unordered_map>
 #include <vector>
 
+#include <omp.h>
+
 namespace fastbc {
 	namespace brandes {
 
@@ -14,47 +19,124 @@ namespace fastbc {
 		class VertexInfoPivotSelector : public IPivotSelector<V, W>
 		{
 		public:
+			/**
+			 *	@brief Initialize a pivot selector grouping vertices by their vertex information
+			 *
+			 *	@details Normalized border SP lengths are rounded to the nearest multiple of a
+			 *			 quantum before grouping, so that lengths differing by floating point
+			 *			 rounding mostly fall in the same class. The quantum of each cluster is
+			 *			 the largest between absoluteEpsilon and relativeEpsilon times the largest
+			 *			 normalized SP length in the cluster: SP lengths of vertices in the same
+			 *			 class differ by at most one quantum. Rounding does not merge every pair
+			 *			 of close lengths: lengths on opposite sides of a half quantum boundary
+			 *			 round to different multiples, however close, and split their vertices
+			 *			 in different classes. With zero epsilons classes require exactly equal
+			 *			 SP lengths.
+			 *
+			 *	@param absoluteEpsilon Minimum quantum of SP lengths
+			 *	@param relativeEpsilon Quantum of SP lengths relative to largest normalized SP length
+			 */
+			VertexInfoPivotSelector(W absoluteEpsilon = 0, W relativeEpsilon = 0);
 
 			std::pair<std::vector<V>, std::vector<V>> selectPivots(
 				const std::vector<W>& globalBC,
-				const std::vector<std::shared_ptr<VertexInfo<V, W>>>& verticesInfo,
+				VertexInfoMatrix<V, W>& clusterVI,
 				const std::vector<V>& vertices,
 				const std::set<V>& borders) override;
+
+			/**
+			 *	@brief Get largest quantum of SP lengths used by pivot selections so far
+			 *
+			 *	@details SP lengths of vertices in the same class, in any cluster, differ by at
+			 *			 most this amount. 0 if SP lengths were compared exactly.
+			 */
+			W largestQuantum() const;
+
+		private:
+			const W _absoluteEpsilon;
+			const W _relativeEpsilon;
+
+			/* Largest quantum used by pivot selections so far */
+			W _largestQuantum;
 		};
 
 	}
 }
 
+template<typename V, typename W>
+fastbc::brandes::VertexInfoPivotSelector<V, W>::VertexInfoPivotSelector(
+	W absoluteEpsilon,
+	W relativeEpsilon)
+	: _absoluteEpsilon(absoluteEpsilon), _relativeEpsilon(relativeEpsilon), _largestQuantum(0)
+{
+	if (_absoluteEpsilon < 0 || _relativeEpsilon < 0)
+	{
+		SPDLOG_ERROR("Negative topological classes epsilon (absolute {}, relative {})",
+			_absoluteEpsilon, _relativeEpsilon);
+		throw std::invalid_argument("Negative topological classes epsilon");
+	}
+}
+
 template<typename V, typename W>
 std::pair<std::vector<V>, std::vector<V>> fastbc::brandes::VertexInfoPivotSelector<V, W>::selectPivots(
 	const std::vector<W>& globalBC,
-	const std::vector<std::shared_ptr<VertexInfo<V, W>>>& verticesInfo,
+	VertexInfoMatrix<V, W>& clusterVI,
 	const std::vector<V>& vertices,
 	const std::set<V>& borders)
 {
-	// Vertex info class representative
-	std::vector<std::shared_ptr<VertexInfo<V, W>>> classes;
+	// Normalize VI before comparison to allow correct class aggregation. Rows are processed
+	// in parallel only outside of parallel regions, as clusters run as tasks of the team
+	W maxLength = 0;
+	#pragma omp parallel for schedule(dynamic, 1024) reduction(max:maxLength) if(!omp_in_parallel())
+	for (size_t row = 0; row < vertices.size(); ++row)
+	{
+		clusterVI.normalize(row);
+		maxLength = std::max(maxLength, clusterVI.getMaxBorderSPLength(row));
+	}
+
+	// Quantize normalized SP lengths, bounding the error within each class
+	W quantum = std::max(_absoluteEpsilon, _relativeEpsilon * maxLength);
+	if (quantum > 0)
+	{
+		SPDLOG_DEBUG("Rounding border SP lengths to multiples of {}", quantum);
+
+		// Clusters select their pivots concurrently
+		#pragma omp critical(fastbc_brandes_vertexinfo_quantum)
+		_largestQuantum = std::max(_largestQuantum, quantum);
+	}
+
+	std::vector<size_t> rowHash(vertices.size());
+	#pragma omp parallel for schedule(dynamic, 1024) if(!omp_in_parallel())
+	for (size_t row = 0; row < vertices.size(); ++row)
+	{
+		if (quantum > 0)
+		{
+			clusterVI.quantize(row, quantum);
+		}
+		rowHash[row] = clusterVI.hash(row);
+	}
+
+	// Vertex info row of class representative
+	std::vector<size_t> classes;
 
 	// Vertices for each class
 	std::vector<std::vector<V>> classMembers;
 
-	// Add each vertex to a class
-	for (const auto& v : vertices)
-	{
-		std::shared_ptr<VertexInfo<V, W>> vVI = verticesInfo[v];
-		
-		// Normalize VI before comparison to allow correct class aggregation
-		vVI->normalize();
+	// Classes with each vertex info hash
+	std::unordered_map<size_t, std::vector<size_t>> hashClasses;
+	hashClasses.reserve(vertices.size());
 
-		// Check if a suitable class already exists
+	// Add each vertex to a class, in order of first member
+	for (size_t row = 0; row < vertices.size(); ++row)
+	{
+		// Check if a suitable class already exists, among the ones with the same hash
+		auto& candidates = hashClasses[rowHash[row]];
 		bool classExists = false;
-		for (V ci = 0; ci < classes.size(); ++ci)
+		for (size_t ci : candidates)
 		{
-			const auto& cVI = classes[ci];
-
-			if (*cVI == *vVI)
+			if (clusterVI.compare(classes[ci], row) == 0)
 			{
-				classMembers[ci].push_back(v);
+				classMembers[ci].push_back(vertices[row]);
 				classExists = true;
 				break;
 			}
@@ -63,8 +145,9 @@ std::pair<std::vector<V>, std::vector<V>> fastbc::brandes::VertexInfoPivotSelect
 		// If no class exists for current vertex generate a new one
 		if (!classExists)
 		{
-			classes.push_back(vVI);
-			classMembers.push_back(std::vector<V>({ v }));
+			candidates.push_back(classes.size());
+			classes.push_back(row);
+			classMembers.push_back(std::vector<V>({ vertices[row] }));
 		}
 	}
 
@@ -126,4 +209,10 @@ std::pair<std::vector<V>, std::vector<V>> fastbc::brandes::VertexInfoPivotSelect
 	return pivot;
 }
 
+template<typename V, typename W>
+W fastbc::brandes::VertexInfoPivotSelector<V, W>::largestQuantum() const
+{
+	return _largestQuantum;
+}
+
 #endif
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include "IKMeans.h"
 
+#include <omp.h>
+
 namespace fastbc {
 	namespace kmeans {
 
@@ -14,7 +16,7 @@ namespace fastbc {
 				int k,
 				const std::vector<V>& vertices,
 				const std::vector<V>& weights,
-				const std::vector<std::shared_ptr<brandes::VertexInfo<V, W>>>& vertexInfo,
+				const brandes::VertexInfoMatrix<V, W>& vertexInfo,
 				W minVariance = 0,
 				size_t maxIteration = 100) override;
 
@@ -23,22 +25,22 @@ namespace fastbc {
 			std::vector<V> _initPlusPlus(
 				int k,
 				const std::vector<V>& vertices,
-				const std::vector<std::shared_ptr<brandes::VertexInfo<V, W>>>& vertexInfo);
+				const brandes::VertexInfoMatrix<V, W>& vertexInfo);
 
 			W _centroidVariance(
 				const std::vector<V>& oldCentroid,
 				const std::vector<V>& newCentroid,
-				const std::vector<std::shared_ptr<brandes::VertexInfo<V, W>>>& vertexInfo);
+				const brandes::VertexInfoMatrix<V, W>& vertexInfo);
 
 			struct InfoCluster { 
-				brandes::VertexInfo<W, W> centroidInfo;
+				brandes::VertexInfoMatrix<W, W> centroidInfo;
 				std::vector<V> vIndices;
 
-				InfoCluster(int borderCount) : centroidInfo(borderCount) {}
+				InfoCluster(int borderCount) : centroidInfo(1, borderCount) {}
 
 				InfoCluster& operator+=(const InfoCluster& other)
 				{
-					centroidInfo += other.centroidInfo;
+					centroidInfo.add(0, other.centroidInfo, 0);
 					vIndices.insert(vIndices.end(), other.vIndices.begin(), other.vIndices.end());
 					return *this;
 				}
@@ -73,7 +75,7 @@ fastbc::kmeans::PlusPlusKMeans<V, W>::computeCentroids(
 	int k,
 	const std::vector<V>& vertices,
 	const std::vector<V>& weights,
-	const std::vector<std::shared_ptr<brandes::VertexInfo<V, W>>>& vertexInfo,
+	const brandes::VertexInfoMatrix<V, W>& vertexInfo,
 	W minVariance,
 	size_t maxIteration)
 {
@@ -81,7 +83,7 @@ fastbc::kmeans::PlusPlusKMeans<V, W>::computeCentroids(
 	std::vector<V> newCentroid = _initPlusPlus(k, vertices, vertexInfo);
 	std::vector<V> centroid(newCentroid.size());
 
-	std::vector<struct InfoCluster> infoCluster(centroid.size(), InfoCluster(vertexInfo[vertices[0]]->borders()));
+	std::vector<struct InfoCluster> infoCluster(centroid.size(), InfoCluster(vertexInfo.borders()));
 	struct InfoCluster* _infoCluster = infoCluster.data();
 	size_t _infoClusterSize = infoCluster.size();
 
@@ -91,18 +93,18 @@ fastbc::kmeans::PlusPlusKMeans<V, W>::computeCentroids(
 		centroid = newCentroid;
 		for (auto& ic : infoCluster) { ic.reset(); }
 
-		// Associate each vertex to nearest cluster
-		#pragma omp parallel for reduction(+:_infoCluster[:_infoClusterSize])
+		// Associate each vertex to nearest cluster, in parallel only outside of parallel regions
+		#pragma omp parallel for reduction(+:_infoCluster[:_infoClusterSize]) if(!omp_in_parallel())
 		for (size_t v = 0; v < vertices.size(); ++v)
 		{
 			struct VertexDistance minC(0, 
-				vertexInfo[centroid[0]]->squaredDistance(*vertexInfo[vertices[v]]));
+				vertexInfo.squaredDistance(centroid[0], vertexInfo, vertices[v]));
 
 			// Select nearest cluster to current vertex
 			#pragma omp simd reduction(min:minC)
 			for (int c = 1; c < centroid.size(); ++c)
 			{
-				W dist = vertexInfo[centroid[c]]->squaredDistance(*vertexInfo[vertices[v]]);
+				W dist = vertexInfo.squaredDistance(centroid[c], vertexInfo, vertices[v]);
 
 				if (dist < minC.distance)
 				{
@@ -112,7 +114,7 @@ fastbc::kmeans::PlusPlusKMeans<V, W>::computeCentroids(
 			}
 
 			// Store vertex association to selected cluster
-			_infoCluster[minC.vertex].centroidInfo += *vertexInfo[vertices[v]];
+			_infoCluster[minC.vertex].centroidInfo.add(0, vertexInfo, vertices[v]);
 			_infoCluster[minC.vertex].vIndices.push_back(v);
 		}
 
@@ -125,16 +127,16 @@ fastbc::kmeans::PlusPlusKMeans<V, W>::computeCentroids(
 				continue;
 			}
 
-			ic.centroidInfo /= ic.vIndices.size();
+			ic.centroidInfo.divide(0, ic.vIndices.size());
 
 			struct VertexDistance minV(ic.vIndices[0],
-				ic.centroidInfo.squaredDistance(*vertexInfo[vertices[ic.vIndices[0]]]));
+				ic.centroidInfo.squaredDistance(0, vertexInfo, vertices[ic.vIndices[0]]));
 
 			// New centroid will be the nearest existing vertex to computed centroid
 			#pragma omp simd reduction(min:minV)
 			for (size_t v = 1; v < ic.vIndices.size(); ++v)
 			{
-				W dist = ic.centroidInfo.squaredDistance(*vertexInfo[vertices[ic.vIndices[v]]]);
+				W dist = ic.centroidInfo.squaredDistance(0, vertexInfo, vertices[ic.vIndices[v]]);
 
 				if (dist < minV.distance)
 				{
@@ -174,7 +176,7 @@ std::vector<V>
 fastbc::kmeans::PlusPlusKMeans<V, W>::_initPlusPlus(
 	int k,
 	const std::vector<V>& vertices,
-	const std::vector<std::shared_ptr<brandes::VertexInfo<V, W>>>& vertexInfo)
+	const brandes::VertexInfoMatrix<V, W>& vertexInfo)
 {
 	std::vector<V> centroid(k);
 	centroid[0] = vertices[0];
@@ -182,7 +184,7 @@ fastbc::kmeans::PlusPlusKMeans<V, W>::_initPlusPlus(
 	std::vector<W> cDist(vertices.size(), 0);
 	for (int i = 1; i < k; ++i)
 	{
-		std::shared_ptr<brandes::VertexInfo<V, W>> lastCentroid = vertexInfo[centroid[i - 1]];
+		V lastCentroid = centroid[i - 1];
 		double p = 1.0 / i;
 		double _p = 1.0 - p;
 
@@ -191,7 +193,7 @@ fastbc::kmeans::PlusPlusKMeans<V, W>::_initPlusPlus(
 		for (int v = 0; v < vertices.size(); ++v)
 		{
 			// Update distance from prevoiusly selected centroids
-			cDist[v] = cDist[v] * _p + lastCentroid->squaredDistance(*vertexInfo[vertices[v]]) * p;
+			cDist[v] = cDist[v] * _p + vertexInfo.squaredDistance(lastCentroid, vertexInfo, vertices[v]) * p;
 
 			// Update farthest from existing centroids
 			if (cDist[v] > cDist[farthestV])
@@ -210,14 +212,14 @@ template<typename V, typename W>
 W fastbc::kmeans::PlusPlusKMeans<V, W>::_centroidVariance(
 	const std::vector<V>& oldCentroid,
 	const std::vector<V>& newCentroid,
-	const std::vector<std::shared_ptr<brandes::VertexInfo<V, W>>>& vertexInfo)
+	const brandes::VertexInfoMatrix<V, W>& vertexInfo)
 {
 	W maxVariance = 0;
 
 	#pragma omp simd reduction(max:maxVariance)
 	for (int c = 0; c < oldCentroid.size(); ++c)
 	{
-		W variance = vertexInfo[oldCentroid[c]]->squaredDistance(*vertexInfo[newCentroid[c]]);
+		W variance = vertexInfo.squaredDistance(oldCentroid[c], vertexInfo, newCentroid[c]);
 
 		if (variance > maxVariance)
 		{
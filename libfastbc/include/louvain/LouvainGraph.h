@@ -1,6 +1,12 @@
 #ifndef FASTBC_LOUVAIN_LOUVAINGRAPH_H
 #define FASTBC_LOUVAIN_LOUVAINGRAPH_H
 
+#include <IDegreeGraph.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 namespace fastbc {
 	namespace louvain {
 
@@ -59,19 +65,18 @@ fastbc::louvain::LouvainGraph<V, W>::LouvainGraph(Graph graph) {
     unsigned long intot = 0, outtot = 0;
     total_weight = 0;
     for(int i=0; i<nb_nodes; i++) {
-        for(auto &[v, w]: graph->backwardStar(i)) {
-            inlinks[intot] = v;
-            inweights[intot] = w;
-            intot += 1;
-            total_weight += w;
-        }
+        const auto bs = graph->backwardStar(i);
+        std::copy(bs.vertices(), bs.vertices() + bs.size(), inlinks.begin() + intot);
+        std::copy(bs.weights(), bs.weights() + bs.size(), inweights.begin() + intot);
+        for(size_t e=0; e<bs.size(); e++)
+            total_weight += bs.weight(e);
+        intot += bs.size();
         indegrees[i] = intot;
 
-        for(auto &[v, w]: graph->forwardStar(i)) {
-            outlinks[outtot] = v;
-            outweights[outtot] = w;
-            outtot += 1;
-        }
+        const auto fs = graph->forwardStar(i);
+        std::copy(fs.vertices(), fs.vertices() + fs.size(), outlinks.begin() + outtot);
+        std::copy(fs.weights(), fs.weights() + fs.size(), outweights.begin() + outtot);
+        outtot += fs.size();
         outdegrees[i] = outtot;
     }
 }
@@ -3,6 +3,7 @@
 
 #include <louvain/LouvainGraph.h>
 #include <algorithm>
+#include <map>
 #include <random>
 
 namespace fastbc {
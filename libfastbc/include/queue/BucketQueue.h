@@ -0,0 +1,179 @@
+#ifndef FASTBC_QUEUE_BUCKETQUEUE_H
+#define FASTBC_QUEUE_BUCKETQUEUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace fastbc {
+	namespace queue {
+
+		/**
+		 *	@brief Vertices priority queue backed by a circular array of buckets (Dial's algorithm)
+		 *
+		 *	@details Keys must be non-negative integer values, either of an integral or of a
+		 *			 floating point type. Each entry is stored in the bucket of its key modulo
+		 *			 the buckets count, which is a power of two grown to cover the spread
+		 *			 between minimum and maximum queued keys, and buckets are scanned from the
+		 *			 minimum key onwards.
+		 *			 With Dijkstra the spread is bounded by the maximum edge weight C, so a
+		 *			 single source visit takes O(m + D) time, D being the largest distance.
+		 *			 Decrease-key inserts a new entry, outdated entries are dropped when met.
+		 *			 Ties are not broken by vertex index. See SetQueue for the policy interface.
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for key value
+		 */
+		template<typename V, typename W>
+		class BucketQueue
+		{
+		public:
+			// Largest keys spread handled, above which buckets memory is not worth it
+			static constexpr size_t maxSpread = size_t(1) << 20;
+
+			void reserve(size_t vertexCount);
+
+			bool empty() const;
+
+			void push(V vertex, W key);
+
+			void decrease(V vertex, W key);
+
+			V pop();
+
+		private:
+			std::vector<std::vector<std::pair<size_t, V>>> _buckets =
+				std::vector<std::vector<std::pair<size_t, V>>>(1);
+			std::vector<size_t> _key;
+			std::vector<bool> _queued;
+			size_t _last = 0;
+			size_t _max = 0;
+			size_t _size = 0;
+
+			void _insert(V vertex, size_t key);
+
+			void _clear();
+		};
+
+	}
+}
+
+template<typename V, typename W>
+void fastbc::queue::BucketQueue<V, W>::reserve(size_t vertexCount)
+{
+	_clear();
+
+	_key.resize(vertexCount);
+	_queued.resize(vertexCount, false);
+	_last = 0;
+	_max = 0;
+	_size = 0;
+}
+
+template<typename V, typename W>
+bool fastbc::queue::BucketQueue<V, W>::empty() const
+{
+	return _size == 0;
+}
+
+template<typename V, typename W>
+void fastbc::queue::BucketQueue<V, W>::push(V vertex, W key)
+{
+	// An empty queue restarts from any key
+	if (_size == 0)
+	{
+		_last = _max = (size_t)key;
+	}
+
+	_queued[vertex] = true;
+	_insert(vertex, (size_t)key);
+	++_size;
+}
+
+template<typename V, typename W>
+void fastbc::queue::BucketQueue<V, W>::decrease(V vertex, W key)
+{
+	_insert(vertex, (size_t)key);
+}
+
+template<typename V, typename W>
+V fastbc::queue::BucketQueue<V, W>::pop()
+{
+	size_t mask = _buckets.size() - 1;
+
+	while (true)
+	{
+		// Current entries in last popped key bucket all have that key
+		auto& bucket = _buckets[_last & mask];
+		while (!bucket.empty())
+		{
+			std::pair<size_t, V> entry = bucket.back();
+			bucket.pop_back();
+
+			if (_queued[entry.second] && _key[entry.second] == entry.first)
+			{
+				_queued[entry.second] = false;
+
+				// Drop outdated entries left once emptied
+				if (--_size == 0)
+				{
+					_clear();
+				}
+
+				return entry.second;
+			}
+		}
+
+		++_last;
+	}
+}
+
+template<typename V, typename W>
+void fastbc::queue::BucketQueue<V, W>::_insert(V vertex, size_t key)
+{
+	// Keys are monotone with Dijkstra, otherwise a lower key rewinds buckets scan
+	_last = std::min(_last, key);
+	_max = std::max(_max, key);
+
+	// Grow buckets to a power of two covering keys spread, redistributing current entries
+	if (_max - _last >= _buckets.size())
+	{
+		size_t count = _buckets.size();
+		while (_max - _last >= count)
+		{
+			count <<= 1;
+		}
+
+		std::vector<std::vector<std::pair<size_t, V>>> buckets(count);
+		for (auto& bucket : _buckets)
+		{
+			for (const auto& entry : bucket)
+			{
+				if (_queued[entry.second] && _key[entry.second] == entry.first)
+				{
+					buckets[entry.first & (count - 1)].push_back(entry);
+				}
+			}
+		}
+		_buckets.swap(buckets);
+	}
+
+	_key[vertex] = key;
+	_buckets[key & (_buckets.size() - 1)].emplace_back(key, vertex);
+}
+
+template<typename V, typename W>
+void fastbc::queue::BucketQueue<V, W>::_clear()
+{
+	for (auto& bucket : _buckets)
+	{
+		for (const auto& entry : bucket)
+		{
+			_queued[entry.second] = false;
+		}
+		bucket.clear();
+	}
+}
+
+#endif
@@ -0,0 +1,169 @@
+#ifndef FASTBC_QUEUE_DARYHEAPQUEUE_H
+#define FASTBC_QUEUE_DARYHEAPQUEUE_H
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace fastbc {
+	namespace queue {
+
+		/**
+		 *	@brief Vertices priority queue backed by an indexed d-ary heap
+		 *
+		 *	@details Heap entries store key and vertex together, so that sift operations
+		 *			 do not access vertex data. Position of each vertex in the heap is
+		 *			 indexed to allow decrease-key. Ties are broken by increasing vertex index.
+		 *			 Position index is left clean once the queue is emptied, hence the queue
+		 *			 can be reused without reset. See SetQueue for the policy interface.
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for key value
+		 *	@tparam D Number of children of each heap node
+		 */
+		template<typename V, typename W, size_t D = 4>
+		class DaryHeapQueue
+		{
+		public:
+			void reserve(size_t vertexCount);
+
+			bool empty() const;
+
+			void push(V vertex, W key);
+
+			void decrease(V vertex, W key);
+
+			V pop();
+
+		private:
+			static constexpr size_t _none = std::numeric_limits<size_t>::max();
+
+			std::vector<std::pair<W, V>> _heap;
+			std::vector<size_t> _position;
+
+			void _siftUp(size_t i);
+
+			void _siftDown(size_t i);
+		};
+
+	}
+}
+
+template<typename V, typename W, size_t D>
+void fastbc::queue::DaryHeapQueue<V, W, D>::reserve(size_t vertexCount)
+{
+	for (const auto& entry : _heap)
+	{
+		_position[entry.second] = _none;
+	}
+	_heap.clear();
+	_position.resize(vertexCount, _none);
+}
+
+template<typename V, typename W, size_t D>
+bool fastbc::queue::DaryHeapQueue<V, W, D>::empty() const
+{
+	return _heap.empty();
+}
+
+template<typename V, typename W, size_t D>
+void fastbc::queue::DaryHeapQueue<V, W, D>::push(V vertex, W key)
+{
+	_heap.emplace_back(key, vertex);
+	_position[vertex] = _heap.size() - 1;
+	_siftUp(_heap.size() - 1);
+}
+
+template<typename V, typename W, size_t D>
+void fastbc::queue::DaryHeapQueue<V, W, D>::decrease(V vertex, W key)
+{
+	size_t i = _position[vertex];
+	_heap[i].first = key;
+	_siftUp(i);
+}
+
+template<typename V, typename W, size_t D>
+V fastbc::queue::DaryHeapQueue<V, W, D>::pop()
+{
+	V vertex = _heap.front().second;
+	_position[vertex] = _none;
+
+	if (_heap.size() > 1)
+	{
+		_heap.front() = _heap.back();
+		_position[_heap.front().second] = 0;
+		_heap.pop_back();
+		_siftDown(0);
+	}
+	else
+	{
+		_heap.pop_back();
+	}
+
+	return vertex;
+}
+
+template<typename V, typename W, size_t D>
+void fastbc::queue::DaryHeapQueue<V, W, D>::_siftUp(size_t i)
+{
+	std::pair<W, V> entry = _heap[i];
+
+	// Move parents down until entry position is found
+	while (i > 0)
+	{
+		size_t parent = (i - 1) / D;
+		if (!(entry < _heap[parent]))
+		{
+			break;
+		}
+
+		_heap[i] = _heap[parent];
+		_position[_heap[i].second] = i;
+		i = parent;
+	}
+
+	_heap[i] = entry;
+	_position[entry.second] = i;
+}
+
+template<typename V, typename W, size_t D>
+void fastbc::queue::DaryHeapQueue<V, W, D>::_siftDown(size_t i)
+{
+	std::pair<W, V> entry = _heap[i];
+	size_t size = _heap.size();
+
+	// Move minimum children up until entry position is found
+	while (true)
+	{
+		size_t first = i * D + 1;
+		if (first >= size)
+		{
+			break;
+		}
+
+		size_t last = first + D < size ? first + D : size;
+		size_t min = first;
+		for (size_t c = first + 1; c < last; ++c)
+		{
+			if (_heap[c] < _heap[min])
+			{
+				min = c;
+			}
+		}
+
+		if (!(_heap[min] < entry))
+		{
+			break;
+		}
+
+		_heap[i] = _heap[min];
+		_position[_heap[i].second] = i;
+		i = min;
+	}
+
+	_heap[i] = entry;
+	_position[entry.second] = i;
+}
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef FASTBC_QUEUE_DEFAULTQUEUE_H
+#define FASTBC_QUEUE_DEFAULTQUEUE_H
+
+#include "DaryHeapQueue.h"
+
+namespace fastbc {
+	namespace queue {
+
+		/**
+		 *	@brief Default priority queue policy for given key type
+		 *
+		 *	@details A d-ary heap, valid for any key. Bucket queues need small non negative
+		 *			 integer keys, so they are selected at run time from graph edge weights
+		 *			 instead (see useBucketQueue).
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for key value
+		 */
+		template<typename V, typename W>
+		using DefaultQueue = DaryHeapQueue<V, W>;
+
+	}
+}
+
+#endif
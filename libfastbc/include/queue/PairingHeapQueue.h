@@ -0,0 +1,179 @@
+#ifndef FASTBC_QUEUE_PAIRINGHEAPQUEUE_H
+#define FASTBC_QUEUE_PAIRINGHEAPQUEUE_H
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace fastbc {
+	namespace queue {
+
+		/**
+		 *	@brief Vertices priority queue backed by a pairing heap
+		 *
+		 *	@details Heap nodes are indexed by vertex and linked through child, sibling and
+		 *			 previous (parent or left sibling) arrays, so that no allocation happens
+		 *			 while the queue is used. Decrease-key cuts the node subtree and melds it
+		 *			 with the root in constant time. Ties are broken by increasing vertex index.
+		 *			 See SetQueue for the policy interface.
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for key value
+		 */
+		template<typename V, typename W>
+		class PairingHeapQueue
+		{
+		public:
+			void reserve(size_t vertexCount);
+
+			bool empty() const;
+
+			void push(V vertex, W key);
+
+			void decrease(V vertex, W key);
+
+			V pop();
+
+		private:
+			static constexpr size_t _none = std::numeric_limits<size_t>::max();
+
+			size_t _root = _none;
+			std::vector<W> _key;
+			std::vector<size_t> _child;
+			std::vector<size_t> _sibling;
+			std::vector<size_t> _prev;
+
+			// Sub-heaps merged by pop
+			std::vector<size_t> _pairs;
+
+			bool _less(size_t lhs, size_t rhs) const;
+
+			size_t _meld(size_t lhs, size_t rhs);
+		};
+
+	}
+}
+
+template<typename V, typename W>
+void fastbc::queue::PairingHeapQueue<V, W>::reserve(size_t vertexCount)
+{
+	while (!empty())
+	{
+		pop();
+	}
+
+	_key.resize(vertexCount);
+	_child.resize(vertexCount, _none);
+	_sibling.resize(vertexCount, _none);
+	_prev.resize(vertexCount, _none);
+}
+
+template<typename V, typename W>
+bool fastbc::queue::PairingHeapQueue<V, W>::empty() const
+{
+	return _root == _none;
+}
+
+template<typename V, typename W>
+void fastbc::queue::PairingHeapQueue<V, W>::push(V vertex, W key)
+{
+	_key[vertex] = key;
+	_root = _root == _none ? vertex : _meld(_root, vertex);
+}
+
+template<typename V, typename W>
+void fastbc::queue::PairingHeapQueue<V, W>::decrease(V vertex, W key)
+{
+	_key[vertex] = key;
+
+	if ((size_t)vertex == _root)
+	{
+		return;
+	}
+
+	// Cut vertex subtree from its parent or left sibling
+	size_t prev = _prev[vertex];
+	if (_child[prev] == (size_t)vertex)
+	{
+		_child[prev] = _sibling[vertex];
+	}
+	else
+	{
+		_sibling[prev] = _sibling[vertex];
+	}
+
+	if (_sibling[vertex] != _none)
+	{
+		_prev[_sibling[vertex]] = prev;
+	}
+
+	_sibling[vertex] = _none;
+	_prev[vertex] = _none;
+
+	_root = _meld(_root, vertex);
+}
+
+template<typename V, typename W>
+V fastbc::queue::PairingHeapQueue<V, W>::pop()
+{
+	size_t min = _root;
+
+	// Meld root children pairwise from left to right
+	_pairs.clear();
+	for (size_t c = _child[min]; c != _none; )
+	{
+		size_t first = c;
+		size_t second = _sibling[first];
+		c = second != _none ? _sibling[second] : _none;
+
+		_sibling[first] = _prev[first] = _none;
+		if (second != _none)
+		{
+			_sibling[second] = _prev[second] = _none;
+			first = _meld(first, second);
+		}
+
+		_pairs.push_back(first);
+	}
+
+	// Meld resulting heaps from right to left
+	_root = _none;
+	for (auto it = _pairs.rbegin(); it != _pairs.rend(); ++it)
+	{
+		_root = _root == _none ? *it : _meld(_root, *it);
+	}
+
+	_child[min] = _none;
+
+	return min;
+}
+
+template<typename V, typename W>
+bool fastbc::queue::PairingHeapQueue<V, W>::_less(size_t lhs, size_t rhs) const
+{
+	if (_key[lhs] == _key[rhs])
+		return lhs < rhs;
+	return _key[lhs] < _key[rhs];
+}
+
+template<typename V, typename W>
+size_t fastbc::queue::PairingHeapQueue<V, W>::_meld(size_t lhs, size_t rhs)
+{
+	if (_less(rhs, lhs))
+	{
+		std::swap(lhs, rhs);
+	}
+
+	// Make rhs the leftmost child of lhs
+	_sibling[rhs] = _child[lhs];
+	if (_child[lhs] != _none)
+	{
+		_prev[_child[lhs]] = rhs;
+	}
+	_prev[rhs] = lhs;
+	_child[lhs] = rhs;
+
+	return lhs;
+}
+
+#endif
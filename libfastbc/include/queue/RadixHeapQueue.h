@@ -0,0 +1,190 @@
+#ifndef FASTBC_QUEUE_RADIXHEAPQUEUE_H
+#define FASTBC_QUEUE_RADIXHEAPQUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fastbc {
+	namespace queue {
+
+		/**
+		 *	@brief Vertices priority queue backed by a radix heap
+		 *
+		 *	@details Radix heap requires monotone keys: a pushed key must not be lower than
+		 *			 the last popped one, which holds for Dijkstra with non-negative weights.
+		 *			 Non-negative integer and floating point keys are mapped to unsigned
+		 *			 integers preserving order, and each entry is stored in the bucket of the
+		 *			 highest bit differing from the last popped key. Decrease-key inserts a
+		 *			 new entry, outdated entries are dropped when met. Ties are not broken by
+		 *			 vertex index. See SetQueue for the policy interface.
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for key value
+		 */
+		template<typename V, typename W>
+		class RadixHeapQueue
+		{
+		public:
+			void reserve(size_t vertexCount);
+
+			bool empty() const;
+
+			void push(V vertex, W key);
+
+			void decrease(V vertex, W key);
+
+			V pop();
+
+		private:
+			using key_t = typename std::conditional<std::is_floating_point<W>::value,
+				typename std::conditional<sizeof(W) == sizeof(uint32_t), uint32_t, uint64_t>::type,
+				typename std::make_unsigned<typename std::conditional<std::is_integral<W>::value, W, int>::type>::type>::type;
+
+			static constexpr size_t _bits = sizeof(key_t) * 8;
+
+			std::vector<std::pair<key_t, V>> _buckets[_bits + 1];
+			std::vector<key_t> _key;
+			std::vector<bool> _queued;
+			key_t _last = 0;
+			size_t _size = 0;
+
+			static key_t _radixKey(W key);
+
+			size_t _bucket(key_t key) const;
+		};
+
+	}
+}
+
+template<typename V, typename W>
+void fastbc::queue::RadixHeapQueue<V, W>::reserve(size_t vertexCount)
+{
+	for (auto& bucket : _buckets)
+	{
+		for (const auto& entry : bucket)
+		{
+			_queued[entry.second] = false;
+		}
+		bucket.clear();
+	}
+
+	_key.resize(vertexCount);
+	_queued.resize(vertexCount, false);
+	_last = 0;
+	_size = 0;
+}
+
+template<typename V, typename W>
+bool fastbc::queue::RadixHeapQueue<V, W>::empty() const
+{
+	return _size == 0;
+}
+
+template<typename V, typename W>
+void fastbc::queue::RadixHeapQueue<V, W>::push(V vertex, W key)
+{
+	key_t k = _radixKey(key);
+
+	_key[vertex] = k;
+	_queued[vertex] = true;
+	_buckets[_bucket(k)].emplace_back(k, vertex);
+	++_size;
+}
+
+template<typename V, typename W>
+void fastbc::queue::RadixHeapQueue<V, W>::decrease(V vertex, W key)
+{
+	key_t k = _radixKey(key);
+
+	_key[vertex] = k;
+	_buckets[_bucket(k)].emplace_back(k, vertex);
+}
+
+template<typename V, typename W>
+V fastbc::queue::RadixHeapQueue<V, W>::pop()
+{
+	auto current = [this](const std::pair<key_t, V>& entry) {
+		return _queued[entry.second] && _key[entry.second] == entry.first;
+	};
+
+	while (true)
+	{
+		// Pop entries at last popped key, skipping outdated ones
+		auto& first = _buckets[0];
+		while (!first.empty())
+		{
+			std::pair<key_t, V> entry = first.back();
+			first.pop_back();
+
+			if (current(entry))
+			{
+				_queued[entry.second] = false;
+				--_size;
+
+				return entry.second;
+			}
+		}
+
+		// Redistribute first non-empty bucket around its minimum key
+		size_t b = 1;
+		while (_buckets[b].empty())
+		{
+			++b;
+		}
+
+		auto& bucket = _buckets[b];
+		key_t min = std::numeric_limits<key_t>::max();
+		for (const auto& entry : bucket)
+		{
+			if (current(entry) && entry.first < min)
+			{
+				min = entry.first;
+			}
+		}
+
+		if (min != std::numeric_limits<key_t>::max())
+		{
+			_last = min;
+		}
+
+		for (const auto& entry : bucket)
+		{
+			if (current(entry))
+			{
+				_buckets[_bucket(entry.first)].push_back(entry);
+			}
+		}
+		bucket.clear();
+	}
+}
+
+template<typename V, typename W>
+typename fastbc::queue::RadixHeapQueue<V, W>::key_t fastbc::queue::RadixHeapQueue<V, W>::_radixKey(W key)
+{
+	if constexpr (std::is_floating_point<W>::value)
+	{
+		// Bit pattern of non-negative IEEE 754 values has the same order of the values
+		key_t k;
+		std::memcpy(&k, &key, sizeof(k));
+		return k;
+	}
+	else
+	{
+		return (key_t)key;
+	}
+}
+
+template<typename V, typename W>
+size_t fastbc::queue::RadixHeapQueue<V, W>::_bucket(key_t key) const
+{
+	key_t diff = key ^ _last;
+
+	return diff ? 64 - __builtin_clzll((unsigned long long)diff) : 0;
+}
+
+#endif
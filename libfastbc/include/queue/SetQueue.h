@@ -0,0 +1,86 @@
+#ifndef FASTBC_QUEUE_SETQUEUE_H
+#define FASTBC_QUEUE_SETQUEUE_H
+
+#include <cstddef>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace fastbc {
+	namespace queue {
+
+		/**
+		 *	@brief Vertices priority queue backed by an ordered set
+		 *
+		 *	@details Reference priority queue policy: vertices are popped by increasing key,
+		 *			 ties are broken by increasing vertex index. Every queue policy exposes
+		 *			 the same interface, so that Dijkstra implementations can select one at
+		 *			 compile time:
+		 *			 - reserve(vertexCount): empty the queue and allow vertex indices up to vertexCount
+		 *			 - empty(): check if there are queued vertices
+		 *			 - push(vertex, key): queue a vertex not already in queue
+		 *			 - decrease(vertex, key): lower the key of a queued vertex
+		 *			 - pop(): remove and return the vertex with minimum key
+		 *
+		 *	@tparam V Type for vertex index number
+		 *	@tparam W Type for key value
+		 */
+		template<typename V, typename W>
+		class SetQueue
+		{
+		public:
+			void reserve(size_t vertexCount);
+
+			bool empty() const;
+
+			void push(V vertex, W key);
+
+			void decrease(V vertex, W key);
+
+			V pop();
+
+		private:
+			std::set<std::pair<W, V>> _queue;
+			std::vector<W> _key;
+		};
+
+	}
+}
+
+template<typename V, typename W>
+void fastbc::queue::SetQueue<V, W>::reserve(size_t vertexCount)
+{
+	_queue.clear();
+	_key.resize(vertexCount);
+}
+
+template<typename V, typename W>
+bool fastbc::queue::SetQueue<V, W>::empty() const
+{
+	return _queue.empty();
+}
+
+template<typename V, typename W>
+void fastbc::queue::SetQueue<V, W>::push(V vertex, W key)
+{
+	_key[vertex] = key;
+	_queue.emplace(key, vertex);
+}
+
+template<typename V, typename W>
+void fastbc::queue::SetQueue<V, W>::decrease(V vertex, W key)
+{
+	_queue.erase(std::make_pair(_key[vertex], vertex));
+	push(vertex, key);
+}
+
+template<typename V, typename W>
+V fastbc::queue::SetQueue<V, W>::pop()
+{
+	V vertex = _queue.begin()->second;
+	_queue.erase(_queue.begin());
+
+	return vertex;
+}
+
+#endif
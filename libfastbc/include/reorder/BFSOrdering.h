@@ -0,0 +1,130 @@
+#ifndef FASTBC_REORDER_BFSORDERING_H
+#define FASTBC_REORDER_BFSORDERING_H
+
+#include "IVertexOrdering.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace fastbc {
+	namespace reorder {
+
+		/**
+		 *	@brief Breadth first vertices ordering
+		 *
+		 *	@details Vertices are numbered in the order a breadth first visit of the graph,
+		 *			 ignoring edges direction, reaches them, so that adjacent vertices get
+		 *			 close indices. With Cuthill-McKee enabled each connected component is
+		 *			 visited starting from a minimum degree vertex and neighbors are visited
+		 *			 by increasing degree; reversing the result gives Reverse Cuthill-McKee (RCM).
+		 */
+		template<typename V, typename W>
+		class BFSOrdering : public IVertexOrdering<V, W>
+		{
+		public:
+
+			/**
+			 *	@brief Initialize a breadth first vertices ordering
+			 *
+			 *	@param cuthillMcKee Visit vertices by increasing degree
+			 *	@param reverse Reverse computed order
+			 */
+			BFSOrdering(bool cuthillMcKee = true, bool reverse = true);
+
+			std::vector<V> computeOrder(std::shared_ptr<const IGraph<V, W>> graph) override;
+
+		private:
+			const bool _cuthillMcKee;
+			const bool _reverse;
+		};
+
+	}
+}
+
+template<typename V, typename W>
+fastbc::reorder::BFSOrdering<V, W>::BFSOrdering(bool cuthillMcKee, bool reverse)
+	: _cuthillMcKee(cuthillMcKee), _reverse(reverse)
+{
+}
+
+template<typename V, typename W>
+std::vector<V> fastbc::reorder::BFSOrdering<V, W>::computeOrder(std::shared_ptr<const IGraph<V, W>> graph)
+{
+	size_t vertexCount = graph->vertices().size();
+
+	// Undirected degree of each vertex
+	std::vector<size_t> degree(vertexCount);
+	#pragma omp parallel for
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		degree[v] = graph->forwardStar(v).size() + graph->backwardStar(v).size();
+	}
+
+	auto degreeCmp = [&degree](const V& lhs, const V& rhs) {
+		if (degree[lhs] == degree[rhs])
+			return lhs < rhs;
+		return degree[lhs] < degree[rhs];
+	};
+
+	// Candidate component roots, by increasing degree for Cuthill-McKee
+	std::vector<V> roots(vertexCount);
+	std::iota(roots.begin(), roots.end(), 0);
+	if (_cuthillMcKee)
+	{
+		std::sort(roots.begin(), roots.end(), degreeCmp);
+	}
+
+	// Computed order doubles as visit queue
+	std::vector<V> order;
+	order.reserve(vertexCount);
+	std::vector<bool> visited(vertexCount, false);
+	std::vector<V> neighbors;
+
+	for (const auto& root : roots)
+	{
+		if (visited[root])
+		{
+			continue;
+		}
+
+		size_t head = order.size();
+		order.push_back(root);
+		visited[root] = true;
+
+		while (head < order.size())
+		{
+			V v = order[head++];
+
+			neighbors.clear();
+			for (const auto& star : { graph->forwardStar(v), graph->backwardStar(v) })
+			{
+				for (size_t i = 0; i < star.size(); ++i)
+				{
+					V w = star.vertex(i);
+					if (!visited[w])
+					{
+						visited[w] = true;
+						neighbors.push_back(w);
+					}
+				}
+			}
+
+			if (_cuthillMcKee)
+			{
+				std::sort(neighbors.begin(), neighbors.end(), degreeCmp);
+			}
+
+			order.insert(order.end(), neighbors.begin(), neighbors.end());
+		}
+	}
+
+	if (_reverse)
+	{
+		std::reverse(order.begin(), order.end());
+	}
+
+	return order;
+}
+
+#endif
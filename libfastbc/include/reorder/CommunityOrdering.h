@@ -0,0 +1,174 @@
+#ifndef FASTBC_REORDER_COMMUNITYORDERING_H
+#define FASTBC_REORDER_COMMUNITYORDERING_H
+
+#include "IVertexOrdering.h"
+#include <IGraphPartition.h>
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace fastbc {
+	namespace reorder {
+
+		/**
+		 *	@brief Community aware vertices ordering
+		 *
+		 *	@details Vertices of each community computed by the wrapped graph partition are
+		 *			 numbered contiguously, in the order of a breadth first visit of the
+		 *			 community. Computed communities are kept and given back, renumbered,
+		 *			 by the next partitionGraph call on the graph renumbered with the
+		 *			 order (see orderApplied), so that a clustered BC computation on the
+		 *			 reordered graph does not partition it again and gets clusters made
+		 *			 of contiguous vertex index ranges.
+		 */
+		template<typename V, typename W>
+		class CommunityOrdering : public IVertexOrdering<V, W>, public IGraphPartition<V, W>
+		{
+		public:
+
+			/**
+			 *	@brief Initialize a community aware vertices ordering
+			 *
+			 *	@param gp Graph partition used to compute communities
+			 */
+			CommunityOrdering(std::shared_ptr<IGraphPartition<V, W>> gp);
+
+			std::vector<V> computeOrder(std::shared_ptr<const IGraph<V, W>> graph) override;
+
+			void orderApplied(std::shared_ptr<const IGraph<V, W>> reordered) override;
+
+			/**
+			 *	@brief Get communities of last ordered graph, with reordered vertex indices
+			 *
+			 *	@details Communities are returned once, provided that given graph is the one
+			 *			 renumbered with the last computed order; wrapped graph partition is
+			 *			 used else.
+			 */
+			std::vector<std::vector<V>> partitionGraph(std::shared_ptr<const IDegreeGraph<V, W>> graph) override;
+
+		private:
+			std::shared_ptr<IGraphPartition<V, W>> _gp;
+			std::vector<std::vector<V>> _orderedCommunities;
+			std::weak_ptr<const IGraph<V, W>> _reordered;
+		};
+
+	}
+}
+
+template<typename V, typename W>
+fastbc::reorder::CommunityOrdering<V, W>::CommunityOrdering(std::shared_ptr<IGraphPartition<V, W>> gp)
+	: _gp(gp)
+{
+}
+
+template<typename V, typename W>
+std::vector<V> fastbc::reorder::CommunityOrdering<V, W>::computeOrder(std::shared_ptr<const IGraph<V, W>> graph)
+{
+	auto degreeGraph = std::dynamic_pointer_cast<const IDegreeGraph<V, W>>(graph);
+	if (!degreeGraph)
+	{
+		throw std::invalid_argument("Community ordering requires a graph with degree information");
+	}
+
+	std::vector<std::vector<V>> communities = _gp->partitionGraph(degreeGraph);
+
+	size_t vertexCount = graph->vertices().size();
+	std::vector<V> community(vertexCount);
+	for (size_t c = 0; c < communities.size(); ++c)
+	{
+		for (const auto& v : communities[c])
+		{
+			community[v] = c;
+		}
+	}
+
+	// Visit each community breadth first, without leaving it
+	std::vector<V> order;
+	order.reserve(vertexCount);
+	std::vector<bool> visited(vertexCount, false);
+	_orderedCommunities.assign(communities.size(), std::vector<V>());
+
+	for (size_t c = 0; c < communities.size(); ++c)
+	{
+		size_t communityBegin = order.size();
+
+		for (const auto& root : communities[c])
+		{
+			if (visited[root])
+			{
+				continue;
+			}
+
+			size_t head = order.size();
+			order.push_back(root);
+			visited[root] = true;
+
+			while (head < order.size())
+			{
+				V v = order[head++];
+
+				for (const auto& star : { graph->forwardStar(v), graph->backwardStar(v) })
+				{
+					for (size_t i = 0; i < star.size(); ++i)
+					{
+						V w = star.vertex(i);
+						if (!visited[w] && community[w] == (V)c)
+						{
+							visited[w] = true;
+							order.push_back(w);
+						}
+					}
+				}
+			}
+		}
+
+		// Community vertices occupy a contiguous range of new indices
+		auto& ordered = _orderedCommunities[c];
+		ordered.resize(order.size() - communityBegin);
+		for (size_t i = 0; i < ordered.size(); ++i)
+		{
+			ordered[i] = communityBegin + i;
+		}
+	}
+
+	// Vertices left out by the partition are placed at the end
+	for (size_t v = 0; v < vertexCount; ++v)
+	{
+		if (!visited[v])
+		{
+			order.push_back(v);
+		}
+	}
+
+	// Communities are bound to the graph renumbered with this order
+	_reordered.reset();
+
+	return order;
+}
+
+template<typename V, typename W>
+void fastbc::reorder::CommunityOrdering<V, W>::orderApplied(std::shared_ptr<const IGraph<V, W>> reordered)
+{
+	_reordered = reordered;
+}
+
+template<typename V, typename W>
+std::vector<std::vector<V>> fastbc::reorder::CommunityOrdering<V, W>::partitionGraph(
+	std::shared_ptr<const IDegreeGraph<V, W>> graph)
+{
+	std::shared_ptr<const IGraph<V, W>> reordered = _reordered.lock();
+	if (!_orderedCommunities.empty() && reordered && reordered.get() == static_cast<const IGraph<V, W>*>(graph.get()))
+	{
+		std::vector<std::vector<V>> communities = std::move(_orderedCommunities);
+		_orderedCommunities.clear();
+		_reordered.reset();
+
+		return communities;
+	}
+
+	return _gp->partitionGraph(graph);
+}
+
+#endif
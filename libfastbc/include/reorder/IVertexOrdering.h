@@ -0,0 +1,41 @@
+#ifndef FASTBC_REORDER_IVERTEXORDERING_H
+#define FASTBC_REORDER_IVERTEXORDERING_H
+
+#include <IGraph.h>
+
+#include <memory>
+#include <vector>
+
+namespace fastbc {
+	namespace reorder {
+
+		template<typename V, typename W>
+		class IVertexOrdering
+		{
+		public:
+
+			/**
+			 *	@brief Compute a new order for graph vertices
+			 *
+			 *	@note graph must be a complete graph (vertex indices from 0 to graph->vertices().size())
+			 *
+			 *	@param graph Graph to compute vertices order for
+			 *	@return std::vector<V> Vertex index placed at each position of the new order
+			 */
+			virtual std::vector<V> computeOrder(std::shared_ptr<const IGraph<V, W>> graph) = 0;
+
+			/**
+			 *	@brief Notify the graph renumbered with the last computed order
+			 *
+			 *	@details Lets orderings bind information computed along with the order to
+			 *			 the renumbered graph instance. Does nothing by default.
+			 *
+			 *	@param reordered Graph renumbered with the last computed order
+			 */
+			virtual void orderApplied(std::shared_ptr<const IGraph<V, W>>) {}
+		};
+
+	}
+}
+
+#endif
@@ -29,7 +29,7 @@ TEST_CASE("Directed weighted graph constructor/getters", "[fastbc]")
 	REQUIRE(fs.find(6)->second == 5);
 	REQUIRE(fs.find(8)->second == 3);
 
-	auto& bs = graph->backwardStar(4);
+	const auto& bs = graph->backwardStar(4);
 	REQUIRE(bs.size() == 3);
 	REQUIRE(bs.find(0)->second == 7);
 	REQUIRE(bs.find(2)->second == 4);
@@ -38,4 +38,30 @@ TEST_CASE("Directed weighted graph constructor/getters", "[fastbc]")
 	REQUIRE(graph->edge(7, 5) == 2);
 	REQUIRE(graph->edge(0, 1) == 4);
 	REQUIRE(graph->edge(1, 0) == 0);
-}
\ No newline at end of file
+}
+TEST_CASE("Directed weighted graph edges added after construction", "[fastbc]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	DirectedWeightedGraph<int, double> graph(dwgText);
+
+	// Existing edge weight is summed, new edges are visible at once
+	graph.addEdge(4, 5, 2);
+	graph.addEdge(4, 7, 6);
+	graph.addEdge(9, 0, 1);
+
+	REQUIRE(graph.edges() == 18);
+	REQUIRE(graph.edge(4, 5) == 3);
+	REQUIRE(graph.edge(4, 7) == 6);
+	REQUIRE(graph.forwardStar(4).size() == 4);
+	REQUIRE(graph.backwardStar(7).find(4)->second == 6);
+	REQUIRE(graph.forwardStar(9).find(0)->second == 1);
+	REQUIRE(graph.backwardStar(0).find(9)->second == 1);
+
+	graph.initVertices();
+	REQUIRE(graph.vertices().size() == 10);
+}
@@ -0,0 +1,61 @@
+#include <catch2/catch.hpp>
+
+#include <EdgeListLoader.h>
+
+#include <DirectedWeightedGraph.h>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+using namespace fastbc;
+
+TEST_CASE("Parallel edge list loader", "[fastbc]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	DirectedWeightedGraph<int, double> reference(dwgText);
+
+	std::shared_ptr<IGraph<int, double>> graph;
+
+	REQUIRE_NOTHROW(graph = EdgeListLoader<int, double>().load("DWGtext.txt"));
+
+	REQUIRE(graph->vertices().size() == reference.vertices().size());
+	REQUIRE(graph->edges() == reference.edges());
+
+	for (int v : reference.vertices())
+	{
+		const auto fs = graph->forwardStar(v);
+		const auto rfs = reference.forwardStar(v);
+		REQUIRE(std::vector<int>(fs.vertices(), fs.vertices() + fs.size()) ==
+			std::vector<int>(rfs.vertices(), rfs.vertices() + rfs.size()));
+		REQUIRE(std::vector<double>(fs.weights(), fs.weights() + fs.size()) ==
+			std::vector<double>(rfs.weights(), rfs.weights() + rfs.size()));
+
+		const auto bs = graph->backwardStar(v);
+		const auto rbs = reference.backwardStar(v);
+		REQUIRE(std::vector<int>(bs.vertices(), bs.vertices() + bs.size()) ==
+			std::vector<int>(rbs.vertices(), rbs.vertices() + rbs.size()));
+	}
+
+	EdgeListLoader<int, double> loader;
+
+	REQUIRE_THROWS(loader.load("missing_DWGtext.txt"));
+
+	// Malformed edge lists are written to the temporary directory and removed afterwards
+	std::filesystem::path invalidPath = std::filesystem::temp_directory_path() / "invalid_DWGtext.txt";
+	std::filesystem::path incompletePath = std::filesystem::temp_directory_path() / "incomplete_DWGtext.txt";
+
+	std::ofstream(invalidPath) << "0 1 2\n1 2 -1\n";
+	std::ofstream(incompletePath) << "0 1 2\n1 2\n";
+
+	CHECK_THROWS_AS(loader.load(invalidPath.string()), std::invalid_argument);
+	CHECK_THROWS_AS(loader.load(incompletePath.string()), std::invalid_argument);
+
+	std::filesystem::remove(invalidPath);
+	std::filesystem::remove(incompletePath);
+}
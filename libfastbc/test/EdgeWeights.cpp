@@ -0,0 +1,59 @@
+#include <catch2/catch.hpp>
+
+#include <CSRGraph.h>
+#include <EdgeWeights.h>
+#include <queue/DaryHeapQueue.h>
+
+#include <fstream>
+#include <vector>
+
+TEST_CASE("Edge weights summary test", "[graph]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	fastbc::CSRGraph<int, float> graph(dwgText);
+	fastbc::EdgeWeights<int, float> weights(graph);
+
+	REQUIRE_FALSE(weights.uniform());
+	REQUIRE(weights.integral());
+	REQUIRE(weights.min() == 1.0f);
+	REQUIRE(weights.max() == 7.0f);
+	REQUIRE(weights.bucketQueue());
+	REQUIRE(fastbc::useBucketQueue<fastbc::queue::DaryHeapQueue<int, float>>(weights));
+	REQUIRE_FALSE(fastbc::useBucketQueue<fastbc::queue::BucketQueue<int, float>>(weights));
+
+	// Fractional and uniform weights
+	fastbc::CSRGraph<int, float> halfGraph(
+		std::vector<int>({ 0, 1, 2 }), std::vector<int>({ 1, 2, 0 }), std::vector<float>({ 0.5f, 0.5f, 0.5f }));
+	fastbc::EdgeWeights<int, float> halfWeights(halfGraph);
+
+	REQUIRE(halfWeights.uniform());
+	REQUIRE_FALSE(halfWeights.integral());
+	REQUIRE(halfWeights.min() == 0.5f);
+	REQUIRE(halfWeights.max() == 0.5f);
+	REQUIRE_FALSE(halfWeights.bucketQueue());
+
+	// Integral weight type
+	fastbc::CSRGraph<int, int> intGraph(
+		std::vector<int>({ 0, 1, 2 }), std::vector<int>({ 1, 2, 0 }), std::vector<int>({ 3, 1, 7 }));
+	fastbc::EdgeWeights<int, int> intWeights(intGraph);
+
+	REQUIRE_FALSE(intWeights.uniform());
+	REQUIRE(intWeights.integral());
+	REQUIRE(intWeights.min() == 1);
+	REQUIRE(intWeights.max() == 7);
+	REQUIRE(intWeights.bucketQueue());
+
+	// Negative and widely spread integral weights do not fit a bucket queue
+	fastbc::CSRGraph<int, int> negativeGraph(
+		std::vector<int>({ 0, 1 }), std::vector<int>({ 1, 0 }), std::vector<int>({ -1, 2 }));
+	fastbc::CSRGraph<int, int> spreadGraph(
+		std::vector<int>({ 0, 1 }), std::vector<int>({ 1, 0 }), std::vector<int>({ 1, 1 << 30 }));
+
+	REQUIRE_FALSE(fastbc::EdgeWeights<int, int>(negativeGraph).bucketQueue());
+	REQUIRE_FALSE(fastbc::EdgeWeights<int, int>(spreadGraph).bucketQueue());
+}
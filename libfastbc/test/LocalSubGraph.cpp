@@ -0,0 +1,81 @@
+#include <catch2/catch.hpp>
+
+#include <LocalSubGraph.h>
+
+#include <DirectedWeightedGraph.h>
+#include <exception>
+#include <fstream>
+#include <memory>
+
+using namespace fastbc;
+
+TEST_CASE("LocalSubGraph contructor and getters", "[fastbc]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	std::shared_ptr<IGraph<int, double>> graph;
+
+	REQUIRE_NOTHROW(graph = std::make_shared<DirectedWeightedGraph<int, double>>(dwgText));
+
+	std::shared_ptr<LocalSubGraph<int, double>> subGraph;
+
+	REQUIRE_NOTHROW(subGraph = std::make_shared<LocalSubGraph<int, double>>(std::vector<int>({ 4, 0, 1, 2, 3 }), graph));
+
+	REQUIRE(subGraph->vertices() == std::vector<int>({ 4, 0, 1, 2, 3 }));
+	REQUIRE(subGraph->edges() == 7);
+
+	REQUIRE(subGraph->forwardStar(4).size() == 0);
+	REQUIRE(subGraph->backwardStar(4).size() == 3);
+
+	const auto& fs = subGraph->forwardStar(3);
+	REQUIRE(fs.size() == 1);
+	REQUIRE(fs.find(4)->second == 3);
+
+	const auto bs = subGraph->backwardStar(4);
+	REQUIRE(std::vector<int>(bs.vertices(), bs.vertices() + bs.size()) == std::vector<int>({ 0, 2, 3 }));
+	REQUIRE(std::vector<double>(bs.weights(), bs.weights() + bs.size()) == std::vector<double>({ 7, 4, 3 }));
+
+	REQUIRE(subGraph->borders().size() == 2);
+	REQUIRE(subGraph->isBorder(3));
+	REQUIRE(subGraph->isBorder(4));
+
+	REQUIRE(subGraph->referenceGraph() == graph);
+}
+
+TEST_CASE("LocalSubGraph local indices", "[fastbc]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	std::shared_ptr<IGraph<int, double>> graph = std::make_shared<DirectedWeightedGraph<int, double>>(dwgText);
+
+	// Non contiguous vertices are numbered by ascending global index
+	LocalSubGraph<int, double> subGraph(std::vector<int>({ 4, 0, 2, 3 }), graph);
+
+	REQUIRE(subGraph.contains(2));
+	REQUIRE_FALSE(subGraph.contains(1));
+	REQUIRE(subGraph.localIndex(0) == 0);
+	REQUIRE(subGraph.localIndex(4) == 3);
+	REQUIRE(subGraph.globalIndex(1) == 2);
+
+	const auto bs = subGraph.localBackwardStar(3);
+	REQUIRE(std::vector<int>(bs.vertices(), bs.vertices() + bs.size()) == std::vector<int>({ 0, 1, 2 }));
+	REQUIRE(std::vector<double>(bs.weights(), bs.weights() + bs.size()) == std::vector<double>({ 7, 4, 3 }));
+
+	REQUIRE(subGraph.localForwardStar(3).size() == 0);
+
+	// Local borders follow borders order
+	std::vector<int> borders;
+	for (const auto& b : subGraph.localBorders())
+	{
+		borders.push_back(subGraph.globalIndex(b));
+	}
+	REQUIRE(borders == std::vector<int>(subGraph.borders().begin(), subGraph.borders().end()));
+}
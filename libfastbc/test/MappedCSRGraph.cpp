@@ -0,0 +1,97 @@
+#include <catch2/catch.hpp>
+
+#include <MappedCSRGraph.h>
+
+#include <CSRGraph.h>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+using namespace fastbc;
+
+TEST_CASE("Binary graph save and mapped open", "[fastbc]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	CSRGraph<int, double> reference(dwgText);
+
+	// Binary graphs are written to the temporary directory and removed afterwards
+	std::string binaryPath = (std::filesystem::temp_directory_path() / "DWGbinary.fbc").string();
+	std::string corruptedPath = (std::filesystem::temp_directory_path() / "DWGcorrupted.fbc").string();
+
+	REQUIRE_NOTHROW(MappedCSRGraph<int, double>::save(reference, binaryPath));
+
+	REQUIRE(MappedCSRGraph<int, double>::isBinaryGraph(binaryPath));
+	REQUIRE_FALSE(MappedCSRGraph<int, double>::isBinaryGraph("DWGtext.txt"));
+
+	std::shared_ptr<IDegreeGraph<int, double>> graph;
+
+	REQUIRE_NOTHROW(graph = std::make_shared<MappedCSRGraph<int, double>>(binaryPath));
+
+	REQUIRE(graph->vertices().size() == 9);
+	REQUIRE(graph->edges() == 16);
+	REQUIRE(graph->totalWeight() == reference.totalWeight());
+
+	for (int v : reference.vertices())
+	{
+		REQUIRE(graph->inWeightedDegree(v) == reference.inWeightedDegree(v));
+		REQUIRE(graph->outWeightedDegree(v) == reference.outWeightedDegree(v));
+		REQUIRE(graph->forwardStar(v).size() == reference.forwardStar(v).size());
+		REQUIRE(graph->backwardStar(v).size() == reference.backwardStar(v).size());
+	}
+
+	const auto& bs = graph->backwardStar(4);
+	REQUIRE(bs.find(0)->second == 7);
+	REQUIRE(bs.find(2)->second == 4);
+	REQUIRE(bs.find(3)->second == 3);
+
+	REQUIRE(graph->edge(7, 5) == 2);
+	REQUIRE(graph->edge(0, 1) == 4);
+	REQUIRE(graph->edge(1, 0) == 0);
+
+	REQUIRE_THROWS(graph->addEdge(1, 0, 1));
+
+	// Stored types must match opening ones
+	using FloatGraph = MappedCSRGraph<int, float>;
+	using DoubleGraph = MappedCSRGraph<int, double>;
+	CHECK_THROWS_AS(FloatGraph(binaryPath), std::invalid_argument);
+	CHECK_THROWS_AS(DoubleGraph("DWGtext.txt"), std::invalid_argument);
+
+	// Corrupted stars are rejected at open: with 9 vertices, forward star offsets
+	// start at byte 128 and forward star vertices at byte 256
+	std::ifstream binaryFile(binaryPath, std::ifstream::binary);
+	std::string binary((std::istreambuf_iterator<char>(binaryFile)), std::istreambuf_iterator<char>());
+	binaryFile.close();
+
+	auto corrupted = [&](size_t offset, auto value)
+	{
+		std::string data = binary;
+		std::memcpy(&data[offset], &value, sizeof(value));
+		std::ofstream(corruptedPath, std::ofstream::binary) << data;
+	};
+
+	corrupted(128, (uint64_t)1);
+	CHECK_THROWS_AS(DoubleGraph(corruptedPath), std::invalid_argument);
+	corrupted(128 + 9 * sizeof(uint64_t), (uint64_t)17);
+	CHECK_THROWS_AS(DoubleGraph(corruptedPath), std::invalid_argument);
+	corrupted(128 + 4 * sizeof(uint64_t), (uint64_t)20);
+	CHECK_THROWS_AS(DoubleGraph(corruptedPath), std::invalid_argument);
+	corrupted(256, (int)9);
+	CHECK_THROWS_AS(DoubleGraph(corruptedPath), std::invalid_argument);
+	corrupted(256, (int)-1);
+	CHECK_THROWS_AS(DoubleGraph(corruptedPath), std::invalid_argument);
+	corrupted(256, (int)1);
+	CHECK_NOTHROW(DoubleGraph(corruptedPath));
+
+	std::filesystem::remove(binaryPath);
+	std::filesystem::remove(corruptedPath);
+}
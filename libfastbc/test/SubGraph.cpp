@@ -38,6 +38,12 @@ TEST_CASE("SubGraph contructor and getters", "[fastbc]")
 	const auto& fs = subGraph->forwardStar(3);
 	REQUIRE(fs.size() == 1);
 	REQUIRE(fs.find(4)->second == 3);
+	REQUIRE(fs.vertices()[0] == 4);
+	REQUIRE(fs.weights()[0] == 3);
+
+	const auto bs = subGraph->backwardStar(4);
+	REQUIRE(std::vector<int>(bs.vertices(), bs.vertices() + bs.size()) == std::vector<int>({ 0, 2, 3 }));
+	REQUIRE(std::vector<double>(bs.weights(), bs.weights() + bs.size()) == std::vector<double>({ 7, 4, 3 }));
 
 	REQUIRE(subGraph->borders().size() == 2);
 	REQUIRE(subGraph->isBorder(3));
@@ -0,0 +1,74 @@
+#include <catch2/catch.hpp>
+
+#include <brandes/BFSClusterEvaluator.h>
+#include <brandes/DijkstraClusterEvaluator.h>
+
+#include <CSRGraph.h>
+#include <LocalSubGraph.h>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+using namespace fastbc::brandes;
+
+TEST_CASE("Breadth first search cluster evaluation test", "[brandes]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	fastbc::CSRGraph<int, float> weightedGraph(dwgText);
+
+	// Same topology of test graph, with edges weighting two
+	std::vector<int> src, dest;
+	std::vector<float> weight;
+	for (int v : weightedGraph.vertices())
+	{
+		const auto fs = weightedGraph.forwardStar(v);
+		for (size_t i = 0; i < fs.size(); ++i)
+		{
+			src.push_back(v);
+			dest.push_back(fs.vertex(i));
+			weight.push_back(2.0f);
+		}
+	}
+
+	std::shared_ptr<fastbc::IGraph<int, float>> fullGraph =
+		std::make_shared<fastbc::CSRGraph<int, float>>(std::move(src), std::move(dest), std::move(weight));
+
+	std::shared_ptr<fastbc::ISubGraph<int, float>> subGraph =
+		std::make_shared<fastbc::LocalSubGraph<int, float>>(std::vector<int>({ 0,1,2,3,4 }), fullGraph);
+
+	std::shared_ptr<IClusterEvaluator<int, float>> dijkstraCE =
+		std::make_shared<DijkstraClusterEvaluator<int, float>>();
+
+	std::shared_ptr<IClusterEvaluator<int, float>> bfsCE =
+		std::make_shared<BFSClusterEvaluator<int, float>>();
+
+	std::vector<float> expectedBC(fullGraph->vertices().size(), 0.0f);
+	VertexInfoMatrix<int, float> expectedVI;
+	dijkstraCE->evaluateCluster(expectedBC, expectedVI, subGraph);
+
+	std::vector<float> globalBC(fullGraph->vertices().size(), 0.0f);
+	VertexInfoMatrix<int, float> globalVI;
+	bfsCE->evaluateCluster(globalBC, globalVI, subGraph);
+
+	// Check betweenness centrality values
+	for (size_t i = 0; i < globalBC.size(); ++i)
+	{
+		REQUIRE(globalBC[i] == Approx(expectedBC[i]));
+	}
+
+	// Check vertices information, with distances in edge weight units
+	REQUIRE(globalVI.rows() == subGraph->vertices().size());
+	for (size_t row = 0; row < globalVI.rows(); ++row)
+	{
+		for (size_t b = 0; b < subGraph->borders().size(); ++b)
+		{
+			REQUIRE(globalVI.counts(row)[b] == expectedVI.counts(row)[b]);
+			REQUIRE(globalVI.lengths(row)[b] == expectedVI.lengths(row)[b]);
+		}
+	}
+}
@@ -0,0 +1,67 @@
+#include <catch2/catch.hpp>
+
+#include <brandes/BFSSSBrandesBC.h>
+#include <brandes/DijkstraSSBrandesBC.h>
+
+#include <CSRGraph.h>
+#include <EdgeWeights.h>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+using namespace fastbc::brandes;
+
+TEST_CASE("Breadth first search single source Brandes BC", "[brandes]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	fastbc::CSRGraph<int, float> weightedGraph(dwgText);
+
+	// Same topology of test graph, with unit weight edges
+	std::vector<int> src, dest;
+	std::vector<float> weight;
+	for (int v : weightedGraph.vertices())
+	{
+		const auto fs = weightedGraph.forwardStar(v);
+		for (size_t i = 0; i < fs.size(); ++i)
+		{
+			src.push_back(v);
+			dest.push_back(fs.vertex(i));
+			weight.push_back(1.0f);
+		}
+	}
+
+	std::shared_ptr<fastbc::IGraph<int, float>> graph =
+		std::make_shared<fastbc::CSRGraph<int, float>>(std::move(src), std::move(dest), std::move(weight));
+
+	REQUIRE(fastbc::EdgeWeights<int, float>(*graph).uniform());
+
+	std::shared_ptr<ISSBrandesBC<int, float>> dijkstraBC =
+		std::make_shared<DijkstraSSBrandesBC<int, float>>();
+
+	std::shared_ptr<ISSBrandesBC<int, float>> topDownBC =
+		std::make_shared<BFSSSBrandesBC<int, float>>(false);
+
+	std::shared_ptr<ISSBrandesBC<int, float>> directionOptimizingBC =
+		std::make_shared<BFSSSBrandesBC<int, float>>(true);
+
+	// Both traversals must match Dijkstra's dependencies from every source
+	for (int source : graph->vertices())
+	{
+		std::vector<float> expected = dijkstraBC->singleSourceBrandes(source, graph);
+		std::vector<float> topDown = topDownBC->singleSourceBrandes(source, graph);
+		std::vector<float> directionOptimizing = directionOptimizingBC->singleSourceBrandes(source, graph);
+
+		REQUIRE(topDown.size() == expected.size());
+		REQUIRE(directionOptimizing.size() == expected.size());
+		for (size_t v = 0; v < expected.size(); ++v)
+		{
+			REQUIRE(topDown[v] == Approx(expected[v]));
+			REQUIRE(directionOptimizing[v] == Approx(expected[v]));
+		}
+	}
+}
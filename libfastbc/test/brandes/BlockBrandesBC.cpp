@@ -0,0 +1,37 @@
+#include <catch2/catch.hpp>
+
+#include "ScaledTestGraph.h"
+
+#include <brandes/BlockBrandesBC.h>
+#include <brandes/DijkstraSSBrandesBC.h>
+
+#include <memory>
+#include <vector>
+
+using namespace fastbc::brandes;
+
+TEST_CASE("Block decomposed Brandes' BC computation test", "[brandes]")
+{
+	// Test graph edges are paired with reverse edges, or kept directed
+	bool symmetric = GENERATE(true, false);
+
+	ScaledTestGraph testGraph;
+	testGraph.addDWGEdges(symmetric);
+
+	// Cycles and trees hanging from test graph vertices, and a separate component
+	int base = testGraph.dwg().vertices().size();
+	std::vector<std::pair<int, int>> blockEdges = {
+		{ 0, base }, { base, base + 1 }, { base + 1, 0 }, { base + 1, base + 2 },
+		{ base + 2, base + 3 }, { base + 3, base + 4 }, { base + 4, base + 2 },
+		{ 4, base + 5 }, { base + 5, base + 6 }, { base + 5, base + 7 },
+		{ base + 8, base + 9 }, { base + 9, base + 10 }, { base + 10, base + 8 } };
+	for (const auto& [u, v] : blockEdges)
+	{
+		testGraph.addEdge(u, v, 2.0f);
+		testGraph.addEdge(v, u, 1.0f);
+	}
+
+	BlockBrandesBC<int, float> blockBrandesBC(std::make_shared<DijkstraSSBrandesBC<int, float>>());
+
+	requireExactBC(blockBrandesBC, testGraph.build());
+}
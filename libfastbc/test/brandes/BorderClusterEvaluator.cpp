@@ -0,0 +1,72 @@
+#include <catch2/catch.hpp>
+
+#include <brandes/BorderClusterEvaluator.h>
+
+#include <DirectedWeightedGraph.h>
+#include <SubGraph.h>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <valarray>
+#include <vector>
+
+using namespace fastbc::brandes;
+
+TEST_CASE("Border rooted cluster evaluation test", "[brandes]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	std::shared_ptr<fastbc::IGraph<int, float>> fullGraph = 
+		std::make_shared<fastbc::DirectedWeightedGraph<int, float>>(dwgText);
+
+	std::shared_ptr<fastbc::ISubGraph<int, float>> subGraph =
+		std::make_shared<fastbc::SubGraph<int, float>>(std::vector<int>({ 0,1,2,3,4 }), fullGraph);
+
+	std::shared_ptr<IClusterEvaluator<int, float>> ce = 
+		std::make_shared<BorderClusterEvaluator<int, float>>();
+
+	std::vector<float> globalBC(fullGraph->vertices().size(), 0.0f);
+	VertexInfoMatrix<int, float> globalVertexInfo;
+
+	ce->evaluateCluster(globalBC, globalVertexInfo, subGraph);
+
+	// Intra-cluster BC is not computed
+	REQUIRE_FALSE(ce->computesClusterBC());
+	for (size_t i = 0; i < globalBC.size(); ++i)
+	{
+		REQUIRE(globalBC[i] == 0.0f);
+	}
+
+	// Check vertices information, a row per sub-graph vertex
+	REQUIRE(globalVertexInfo.rows() == 5);
+	REQUIRE(globalVertexInfo.borders() == 2);
+
+	REQUIRE(globalVertexInfo.counts(0)[0] == 1);
+	REQUIRE(globalVertexInfo.lengths(0)[0] == 5.0f);
+	REQUIRE(globalVertexInfo.counts(0)[1] == 2);
+	REQUIRE(globalVertexInfo.lengths(0)[1] == 7.0f);
+
+	REQUIRE(globalVertexInfo.counts(1)[0] == 1);
+	REQUIRE(globalVertexInfo.lengths(1)[0] == 1.0f);
+	REQUIRE(globalVertexInfo.counts(1)[1] == 1);
+	REQUIRE(globalVertexInfo.lengths(1)[1] == 4.0f);
+
+	REQUIRE(globalVertexInfo.counts(2)[0] == 1);
+	REQUIRE(globalVertexInfo.lengths(2)[0] == 8.0f);
+	REQUIRE(globalVertexInfo.counts(2)[1] == 1);
+	REQUIRE(globalVertexInfo.lengths(2)[1] == 4.0f);
+
+	REQUIRE(globalVertexInfo.counts(3)[0] == 1);
+	REQUIRE(globalVertexInfo.lengths(3)[0] == 0.0f);
+	REQUIRE(globalVertexInfo.counts(3)[1] == 1);
+	REQUIRE(globalVertexInfo.lengths(3)[1] == 3.0f);
+
+	REQUIRE(globalVertexInfo.counts(4)[0] == 0);
+	REQUIRE(globalVertexInfo.lengths(4)[0] == 0);
+	REQUIRE(globalVertexInfo.counts(4)[1] == 1);
+	REQUIRE(globalVertexInfo.lengths(4)[1] == 0.0f);
+}
\ No newline at end of file
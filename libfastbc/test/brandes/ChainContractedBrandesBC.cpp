@@ -0,0 +1,65 @@
+#include <catch2/catch.hpp>
+
+#include "ScaledTestGraph.h"
+
+#include <brandes/ChainContractedBrandesBC.h>
+#include <brandes/ExactBrandesBC.h>
+
+#include <CSRGraph.h>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+using namespace fastbc::brandes;
+
+TEST_CASE("Chain contracted Brandes' BC computation test", "[brandes]")
+{
+	ScaledTestGraph testGraph;
+	testGraph.addDWGEdges();
+
+	// Chains between test graph vertices, a parallel chain, a loop, a cycle and a dangling chain
+	std::vector<std::vector<int>> chains = {
+		{ 0, 9, 10, 11, 5 }, { 2, 12, 7 }, { 0, 13, 14, 5 }, { 4, 15, 16, 4 },
+		{ 17, 18, 19, 17 }, { 6, 20, 21 } };
+	std::vector<float> chainWeights = { 1.0f, 2.0f, 1.0f, 3.0f, 2.0f };
+	for (const auto& chain : chains)
+	{
+		for (size_t i = 0; i + 1 < chain.size(); ++i)
+		{
+			testGraph.addEdge(chain[i], chain[i + 1], chainWeights[i]);
+			testGraph.addEdge(chain[i + 1], chain[i], chainWeights[i]);
+		}
+	}
+
+	ChainContractedBrandesBC<int, float> contractedBrandesBC;
+
+	requireExactBC(contractedBrandesBC, testGraph.build());
+}
+
+TEST_CASE("Chain contracted Brandes' BC computation on fractional parallel chains test", "[brandes]")
+{
+	// Parallel chains 1-2-3 and 1-4-3, whose lengths are rounded differently when summed in advance
+	std::vector<int> src, dest;
+	std::vector<double> weight;
+	std::vector<std::tuple<int, int, double>> edges = {
+		{ 0, 1, 0.1 }, { 1, 2, 0.2 }, { 2, 3, 0.3 }, { 1, 4, 0.2 }, { 4, 3, 0.3 }, { 3, 5, 1.0 } };
+	for (const auto& [from, to, w] : edges)
+	{
+		src.insert(src.end(), { from, to });
+		dest.insert(dest.end(), { to, from });
+		weight.insert(weight.end(), 2, w);
+	}
+
+	std::shared_ptr<fastbc::IGraph<int, double>> graph =
+		std::make_shared<fastbc::CSRGraph<int, double>>(std::move(src), std::move(dest), std::move(weight));
+
+	std::vector<double> expectedBC = ExactBrandesBC<int, double>().computeBC(graph);
+	std::vector<double> graphBC = ChainContractedBrandesBC<int, double>().computeBC(graph);
+
+	REQUIRE(graphBC.size() == expectedBC.size());
+	for (size_t i = 0; i < graphBC.size(); ++i)
+	{
+		REQUIRE(graphBC[i] == Approx(expectedBC[i]));
+	}
+	REQUIRE(graphBC[2] == Approx(graphBC[4]));
+}
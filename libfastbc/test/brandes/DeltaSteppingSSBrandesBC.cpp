@@ -0,0 +1,91 @@
+#include <catch2/catch.hpp>
+
+#include <brandes/DeltaSteppingSSBrandesBC.h>
+#include <brandes/DijkstraSSBrandesBC.h>
+
+#include <CSRGraph.h>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include <omp.h>
+
+using namespace fastbc::brandes;
+
+TEST_CASE("Delta-stepping single source Brandes BC", "[brandes]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	std::shared_ptr<fastbc::IGraph<int, float>> graph =
+		std::make_shared<fastbc::CSRGraph<int, float>>(dwgText);
+
+	std::shared_ptr<ISSBrandesBC<int, float>> dijkstraBC =
+		std::make_shared<DijkstraSSBrandesBC<int, float>>();
+
+	// Single bucket with light edges only, automatic width and many buckets with heavy edges
+	float bucketWidth = GENERATE(100.0f, 0.0f, 0.5f);
+	std::shared_ptr<ISSBrandesBC<int, float>> deltaSteppingBC =
+		std::make_shared<DeltaSteppingSSBrandesBC<int, float>>(bucketWidth);
+
+	// Run with several threads even on a single core
+	int threads = omp_get_max_threads();
+	omp_set_num_threads(4);
+
+	for (int source : graph->vertices())
+	{
+		std::vector<float> expected = dijkstraBC->singleSourceBrandes(source, graph);
+		std::vector<float> ssBC = deltaSteppingBC->singleSourceBrandes(source, graph);
+
+		REQUIRE(ssBC.size() == expected.size());
+		for (size_t v = 0; v < expected.size(); ++v)
+		{
+			REQUIRE(ssBC[v] == Approx(expected[v]));
+		}
+	}
+
+	// Vertices standing for groups of vertices
+	std::vector<float> vertexWeights(graph->vertices().size());
+	for (size_t v = 0; v < vertexWeights.size(); ++v)
+	{
+		vertexWeights[v] = 1 + v % 3;
+	}
+
+	for (int source : graph->vertices())
+	{
+		std::vector<float> expected(vertexWeights.size(), 0), expectedReached(vertexWeights.size(), 0);
+		std::vector<float> ssBC(vertexWeights.size(), 0), reached(vertexWeights.size(), 0);
+
+		float expectedReach = dijkstraBC->accumulateWeightedBrandes(
+			source, graph, vertexWeights, 1, expected.data(), expectedReached.data());
+		float reach = deltaSteppingBC->accumulateWeightedBrandes(
+			source, graph, vertexWeights, 1, ssBC.data(), reached.data());
+
+		REQUIRE(reach == Approx(expectedReach));
+		for (size_t v = 0; v < expected.size(); ++v)
+		{
+			REQUIRE(ssBC[v] == Approx(expected[v]));
+			REQUIRE(reached[v] == Approx(expectedReached[v]));
+		}
+	}
+
+	// Cached graph parameters are not reused on a different graph
+	std::shared_ptr<fastbc::IGraph<int, float>> halfGraph = std::make_shared<fastbc::CSRGraph<int, float>>(
+		std::vector<int>({ 0, 1, 0, 2 }), std::vector<int>({ 1, 2, 2, 3 }), std::vector<float>({ 0.25f, 0.25f, 0.5f, 0.5f }));
+	for (int source : halfGraph->vertices())
+	{
+		std::vector<float> expected = dijkstraBC->singleSourceBrandes(source, halfGraph);
+		std::vector<float> ssBC = deltaSteppingBC->singleSourceBrandes(source, halfGraph);
+
+		REQUIRE(ssBC.size() == expected.size());
+		for (size_t v = 0; v < expected.size(); ++v)
+		{
+			REQUIRE(ssBC[v] == Approx(expected[v]));
+		}
+	}
+
+	omp_set_num_threads(threads);
+}
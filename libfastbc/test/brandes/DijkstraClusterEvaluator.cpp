@@ -30,7 +30,7 @@ TEST_CASE("Dijkstra cluster evaluation test", "[brandes]")
 		std::make_shared<DijkstraClusterEvaluator<int, float>>();
 
 	std::vector<float> globalBC(fullGraph->vertices().size(), 0.0f);
-	std::vector<std::shared_ptr<VertexInfo<int, float>>> globalVertexInfo(fullGraph->vertices().size(), nullptr);
+	VertexInfoMatrix<int, float> globalVertexInfo;
 
 	ce->evaluateCluster(globalBC, globalVertexInfo, subGraph);
 
@@ -46,30 +46,32 @@ TEST_CASE("Dijkstra cluster evaluation test", "[brandes]")
 		REQUIRE(globalBC[i] == 0.0f);
 	}
 
-	// Check vertices information
-
-	REQUIRE(globalVertexInfo[0]->getBorderSPCount(0) == 1);
-	REQUIRE(globalVertexInfo[0]->getBorderSPLength(0) == 5.0f);
-	REQUIRE(globalVertexInfo[0]->getBorderSPCount(1) == 2);
-	REQUIRE(globalVertexInfo[0]->getBorderSPLength(1) == 7.0f);
-
-	REQUIRE(globalVertexInfo[1]->getBorderSPCount(0) == 1);
-	REQUIRE(globalVertexInfo[1]->getBorderSPLength(0) == 1.0f);
-	REQUIRE(globalVertexInfo[1]->getBorderSPCount(1) == 1);
-	REQUIRE(globalVertexInfo[1]->getBorderSPLength(1) == 4.0f);
-
-	REQUIRE(globalVertexInfo[2]->getBorderSPCount(0) == 1);
-	REQUIRE(globalVertexInfo[2]->getBorderSPLength(0) == 8.0f);
-	REQUIRE(globalVertexInfo[2]->getBorderSPCount(1) == 1);
-	REQUIRE(globalVertexInfo[2]->getBorderSPLength(1) == 4.0f);
-
-	REQUIRE(globalVertexInfo[3]->getBorderSPCount(0) == 1);
-	REQUIRE(globalVertexInfo[3]->getBorderSPLength(0) == 0.0f);
-	REQUIRE(globalVertexInfo[3]->getBorderSPCount(1) == 1);
-	REQUIRE(globalVertexInfo[3]->getBorderSPLength(1) == 3.0f);
-
-	REQUIRE(globalVertexInfo[4]->getBorderSPCount(0) == 0);
-	REQUIRE(globalVertexInfo[4]->getBorderSPLength(0) == 0);
-	REQUIRE(globalVertexInfo[4]->getBorderSPCount(1) == 1);
-	REQUIRE(globalVertexInfo[4]->getBorderSPLength(1) == 0.0f);
+	// Check vertices information, a row per sub-graph vertex
+	REQUIRE(globalVertexInfo.rows() == 5);
+	REQUIRE(globalVertexInfo.borders() == 2);
+
+	REQUIRE(globalVertexInfo.counts(0)[0] == 1);
+	REQUIRE(globalVertexInfo.lengths(0)[0] == 5.0f);
+	REQUIRE(globalVertexInfo.counts(0)[1] == 2);
+	REQUIRE(globalVertexInfo.lengths(0)[1] == 7.0f);
+
+	REQUIRE(globalVertexInfo.counts(1)[0] == 1);
+	REQUIRE(globalVertexInfo.lengths(1)[0] == 1.0f);
+	REQUIRE(globalVertexInfo.counts(1)[1] == 1);
+	REQUIRE(globalVertexInfo.lengths(1)[1] == 4.0f);
+
+	REQUIRE(globalVertexInfo.counts(2)[0] == 1);
+	REQUIRE(globalVertexInfo.lengths(2)[0] == 8.0f);
+	REQUIRE(globalVertexInfo.counts(2)[1] == 1);
+	REQUIRE(globalVertexInfo.lengths(2)[1] == 4.0f);
+
+	REQUIRE(globalVertexInfo.counts(3)[0] == 1);
+	REQUIRE(globalVertexInfo.lengths(3)[0] == 0.0f);
+	REQUIRE(globalVertexInfo.counts(3)[1] == 1);
+	REQUIRE(globalVertexInfo.lengths(3)[1] == 3.0f);
+
+	REQUIRE(globalVertexInfo.counts(4)[0] == 0);
+	REQUIRE(globalVertexInfo.lengths(4)[0] == 0);
+	REQUIRE(globalVertexInfo.counts(4)[1] == 1);
+	REQUIRE(globalVertexInfo.lengths(4)[1] == 0.0f);
 }
\ No newline at end of file
@@ -26,4 +26,30 @@ TEST_CASE("Single source Brandes BC", "[brandes]")
 	std::vector<float> globalBC = ssBC->singleSourceBrandes(0, fullGraph);
 
 	REQUIRE(globalBC.size() == fullGraph->vertices().size());
-}
\ No newline at end of file
+}
+
+TEST_CASE("Single source Brandes BC accumulation", "[brandes]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	std::shared_ptr<fastbc::IGraph<int, float>> fullGraph =
+		std::make_shared<fastbc::DirectedWeightedGraph<int, float>>(dwgText);
+
+	std::shared_ptr<ISSBrandesBC<int, float>> ssBC =
+		std::make_shared<DijkstraSSBrandesBC<int, float>>();
+
+	std::vector<float> dependency = ssBC->singleSourceBrandes(0, fullGraph);
+
+	// Scaled dependency is summed to existing values
+	std::vector<float> accumulated(fullGraph->vertices().size(), 1.0f);
+	ssBC->accumulateBrandes(0, fullGraph, 3.0f, accumulated.data());
+
+	for (size_t v = 0; v < accumulated.size(); ++v)
+	{
+		REQUIRE(accumulated[v] == 1.0f + dependency[v] * 3.0f);
+	}
+}
@@ -22,8 +22,10 @@ TEST_CASE("Exact Brandes' BC computation test", "[brandes]")
 	std::shared_ptr<fastbc::ISubGraph<int, float>> subGraph =
 		std::make_shared<fastbc::SubGraph<int, float>>(std::vector<int>({ 0,1,2,3,4 }), fullGraph);
 
+	// Sources visited in parallel, or one at a time by delta-stepping
+	bool deltaStepping = GENERATE(false, true);
     std::shared_ptr<IBrandesBC<int, float>> exactBrandesBC = 
-        std::make_shared<ExactBrandesBC<int, float>>();
+        std::make_shared<ExactBrandesBC<int, float>>(deltaStepping);
 
     std::vector<float> graphBC = exactBrandesBC->computeBC(subGraph);
 
@@ -0,0 +1,103 @@
+#include <catch2/catch.hpp>
+
+#include <brandes/BFSSSBrandesBC.h>
+#include <brandes/MultiSourceBFSBrandesBC.h>
+
+#include <CSRGraph.h>
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace fastbc::brandes;
+
+TEST_CASE("Multi source breadth first search Brandes BC", "[brandes]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	fastbc::CSRGraph<int, float> weightedGraph(dwgText);
+
+	// Same topology of test graph, with unit weight edges
+	std::vector<int> src, dest;
+	std::vector<float> weight;
+	for (int v : weightedGraph.vertices())
+	{
+		const auto fs = weightedGraph.forwardStar(v);
+		for (size_t i = 0; i < fs.size(); ++i)
+		{
+			src.push_back(v);
+			dest.push_back(fs.vertex(i));
+			weight.push_back(1.0f);
+		}
+	}
+
+	std::shared_ptr<fastbc::IGraph<int, float>> graph =
+		std::make_shared<fastbc::CSRGraph<int, float>>(std::move(src), std::move(dest), std::move(weight));
+
+	BFSSSBrandesBC<int, float> ssBC;
+	MultiSourceBFSBrandesBC<int, float> msBC;
+
+	// Every vertex as source, one of them twice, with different scales
+	std::vector<int> sources;
+	std::vector<float> scales;
+	for (int v : graph->vertices())
+	{
+		sources.push_back(v);
+		scales.push_back(1.0f + v);
+	}
+	sources.push_back(0);
+	scales.push_back(0.5f);
+
+	std::vector<float> expected(graph->vertices().size(), 0.0f);
+	for (size_t i = 0; i < sources.size(); ++i)
+	{
+		ssBC.accumulateBrandes(sources[i], graph, scales[i], expected.data());
+	}
+
+	// Batches reuse buffers of previous ones
+	for (int run = 0; run < 2; ++run)
+	{
+		std::vector<float> batchBC(graph->vertices().size(), 0.0f);
+		msBC.accumulateBrandes(sources, graph, scales, batchBC.data());
+
+		for (size_t v = 0; v < expected.size(); ++v)
+		{
+			REQUIRE(batchBC[v] == Approx(expected[v]));
+		}
+	}
+
+	// Narrower batches, reallocating buffers of this thread
+	MultiSourceBFSBrandesBC<int, float> narrowBC(4);
+	std::vector<float> narrowBatchBC(graph->vertices().size(), 0.0f);
+	for (size_t b = 0; b < sources.size(); b += narrowBC.lanes())
+	{
+		size_t end = std::min(b + narrowBC.lanes(), sources.size());
+		narrowBC.accumulateBrandes(
+			std::vector<int>(sources.begin() + b, sources.begin() + end), graph,
+			std::vector<float>(scales.begin() + b, scales.begin() + end), narrowBatchBC.data());
+	}
+	for (size_t v = 0; v < expected.size(); ++v)
+	{
+		REQUIRE(narrowBatchBC[v] == Approx(expected[v]));
+	}
+
+	// Batches larger than lanes are rejected
+	std::vector<int> tooMany(narrowBC.lanes() + 1, 0);
+	std::vector<float> tooManyScales(tooMany.size(), 1.0f);
+	std::vector<float> bc(graph->vertices().size(), 0.0f);
+	REQUIRE_THROWS_AS(narrowBC.accumulateBrandes(tooMany, graph, tooManyScales, bc.data()), std::invalid_argument);
+	REQUIRE_THROWS_AS((MultiSourceBFSBrandesBC<int, float>(0)), std::invalid_argument);
+	REQUIRE_THROWS_AS((MultiSourceBFSBrandesBC<int, float>(65)), std::invalid_argument);
+
+	// Lanes fitting in memory of each thread
+	size_t vertexCount = 1000;
+	size_t memory = MultiSourceBFSBrandesBC<int, float>::workspaceBytes(vertexCount, 16) * 4;
+	REQUIRE(MultiSourceBFSBrandesBC<int, float>::fittingLanes(vertexCount, 4, memory) == 16);
+	REQUIRE(MultiSourceBFSBrandesBC<int, float>::fittingLanes(vertexCount, 1, memory) == 64);
+	REQUIRE(MultiSourceBFSBrandesBC<int, float>::fittingLanes(vertexCount, 4, 1000) == 0);
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch.hpp>
+
+#include <brandes/ParallelAccumulator.h>
+
+#include <vector>
+
+using namespace fastbc::brandes;
+
+TEST_CASE("Parallel accumulator merge test", "[brandes]")
+{
+	const size_t size = 1000;
+	ParallelAccumulator<double> accumulator(size);
+
+	// Accumulate over two parallel regions before merging
+	for (int region = 0; region < 2; ++region)
+	{
+		#pragma omp parallel for
+		for (int i = 0; i < 10000; ++i)
+		{
+			accumulator.local()[i % size] += 1.0;
+		}
+	}
+
+	std::vector<double> target(size, 1.0);
+	accumulator.mergeInto(target.data());
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		REQUIRE(target[i] == 21.0);
+	}
+
+	// Buffers are reset by merge
+	accumulator.mergeInto(target.data());
+	REQUIRE(target[0] == 21.0);
+}
+
+TEST_CASE("Parallel accumulator in parallel region test", "[brandes]")
+{
+	const size_t size = 100;
+	std::vector<double> target(size, 0.0);
+
+	#pragma omp parallel num_threads(4)
+	#pragma omp single
+	{
+		// Nested regions would run on a single thread, tasks on the whole enclosing team
+		omp_set_num_threads(1);
+		ParallelAccumulator<double> accumulator(size);
+
+		#pragma omp taskloop num_tasks(100) shared(accumulator)
+		for (int i = 0; i < 10000; ++i)
+		{
+			accumulator.local()[i % size] += 1.0;
+		}
+
+		accumulator.mergeInto(target.data());
+	}
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		REQUIRE(target[i] == 100.0);
+	}
+}
@@ -0,0 +1,33 @@
+#include <catch2/catch.hpp>
+
+#include "ScaledTestGraph.h"
+
+#include <brandes/DijkstraSSBrandesBC.h>
+#include <brandes/PrunedBrandesBC.h>
+
+#include <memory>
+#include <vector>
+
+using namespace fastbc::brandes;
+
+TEST_CASE("Pruned Brandes' BC computation test", "[brandes]")
+{
+	ScaledTestGraph testGraph;
+	testGraph.addDWGEdges();
+
+	// Trees hanging from test graph vertices, an isolated tree and a one way pendant vertex
+	int base = testGraph.dwg().vertices().size();
+	std::vector<std::pair<int, int>> treeEdges = {
+		{ 0, base }, { base, base + 1 }, { base, base + 2 }, { base + 2, base + 3 },
+		{ 3, base + 4 }, { base + 5, base + 6 }, { base + 6, base + 7 } };
+	for (const auto& [u, v] : treeEdges)
+	{
+		testGraph.addEdge(u, v, 2.0f);
+		testGraph.addEdge(v, u, 2.0f);
+	}
+	testGraph.addEdge(base + 8, 2, 1.0f);
+
+	PrunedBrandesBC<int, float> prunedBrandesBC(std::make_shared<DijkstraSSBrandesBC<int, float>>());
+
+	requireExactBC(prunedBrandesBC, testGraph.build());
+}
@@ -0,0 +1,40 @@
+#include <catch2/catch.hpp>
+
+#include <brandes/ExactBrandesBC.h>
+#include <brandes/ReorderedBrandesBC.h>
+#include <reorder/BFSOrdering.h>
+
+#include <CSRGraph.h>
+#include <fstream>
+
+using namespace fastbc::brandes;
+
+TEST_CASE("Reordered Brandes' BC computation test", "[brandes]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	std::shared_ptr<fastbc::IGraph<int, float>> graph =
+		std::make_shared<fastbc::CSRGraph<int, float>>(dwgText);
+
+	std::shared_ptr<IBrandesBC<int, float>> exactBrandesBC =
+		std::make_shared<ExactBrandesBC<int, float>>();
+
+	std::shared_ptr<IBrandesBC<int, float>> reorderedBrandesBC =
+		std::make_shared<ReorderedBrandesBC<int, float>>(
+			std::make_shared<fastbc::reorder::BFSOrdering<int, float>>(),
+			exactBrandesBC);
+
+	std::vector<float> expectedBC = exactBrandesBC->computeBC(graph);
+	std::vector<float> graphBC = reorderedBrandesBC->computeBC(graph);
+
+	// BC must be given back with original vertex indices
+	REQUIRE(graphBC.size() == expectedBC.size());
+	for (size_t i = 0; i < graphBC.size(); ++i)
+	{
+		REQUIRE(graphBC[i] == Approx(expectedBC[i]));
+	}
+}
@@ -0,0 +1,51 @@
+#include <catch2/catch.hpp>
+
+#include <brandes/SSSPWorkspace.h>
+
+#include <limits>
+
+using namespace fastbc::brandes;
+
+TEST_CASE("SSSP workspace sparse reset test", "[brandes]")
+{
+	SSSPWorkspace<int, float> workspace;
+
+	workspace.prepare(5);
+	REQUIRE(workspace.dist.size() == 5);
+	REQUIRE(workspace.spPredHead.size() == 5);
+
+	// Simulate a visit reaching vertices 1 and 3
+	workspace.dist[1] = 0;
+	workspace.sigma[1] = 1;
+	workspace.dist[3] = 2;
+	workspace.sigma[3] = 1;
+	workspace.delta[1] = 1;
+	workspace.spPred.emplace_back(1, workspace.none);
+	workspace.spPredHead[3] = 0;
+	workspace.visitStack = { 1, 3 };
+
+	workspace.release();
+	REQUIRE(workspace.visitStack.empty());
+	REQUIRE(workspace.spPred.empty());
+
+	workspace.prepare(5);
+	for (int v = 0; v < 5; ++v)
+	{
+		REQUIRE(workspace.dist[v] == std::numeric_limits<float>::max());
+		REQUIRE(workspace.sigma[v] == 0);
+		REQUIRE(workspace.delta[v] == 0);
+		REQUIRE(workspace.spPredHead[v] == workspace.none);
+	}
+
+	// Unreleased workspace is fully reset
+	workspace.dist[4] = 1;
+	workspace.prepare(5);
+	REQUIRE(workspace.dist[4] == std::numeric_limits<float>::max());
+
+	// Workspace is resized on vertices count change
+	workspace.prepare(8);
+	REQUIRE(workspace.dist.size() == 8);
+	REQUIRE(workspace.dist[7] == std::numeric_limits<float>::max());
+
+	REQUIRE(&SSSPWorkspace<int, float>::local() == &SSSPWorkspace<int, float>::local());
+}
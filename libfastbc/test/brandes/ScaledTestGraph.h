@@ -0,0 +1,127 @@
+#ifndef FASTBC_TEST_BRANDES_SCALEDTESTGRAPH_H
+#define FASTBC_TEST_BRANDES_SCALEDTESTGRAPH_H
+
+#include <catch2/catch.hpp>
+
+#include <brandes/ExactBrandesBC.h>
+#include <brandes/IBrandesBC.h>
+
+#include <CSRGraph.h>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ *	@brief Test graph made of the DWGtext test graph and of extra edges, whose edge weights
+ *		   are scaled
+ *
+ *	@details Each test case using it runs with integral, fractional and unit edge weights.
+ *			 Exact BC reductions are checked against ExactBrandesBC on the built graph.
+ */
+class ScaledTestGraph
+{
+public:
+	/**
+	 *	@brief Load test graph and generate the scale of edge weights
+	 */
+	ScaledTestGraph();
+
+	/**
+	 *	@brief Get loaded test graph, with unscaled edge weights
+	 */
+	const fastbc::CSRGraph<int, float>& dwg() const;
+
+	/**
+	 *	@brief Add an edge whose weight is scaled, or 1 with unit weights
+	 */
+	void addEdge(int u, int v, float w);
+
+	/**
+	 *	@brief Add test graph edges
+	 *
+	 *	@param symmetric Pair each edge with a reverse edge of the same weight
+	 */
+	void addDWGEdges(bool symmetric = false);
+
+	/**
+	 *	@brief Build a graph from edges added so far
+	 */
+	std::shared_ptr<fastbc::IGraph<int, float>> build();
+
+private:
+	std::shared_ptr<fastbc::CSRGraph<int, float>> _dwg;
+	float _scale;
+
+	std::vector<int> _src;
+	std::vector<int> _dest;
+	std::vector<float> _weight;
+};
+
+/**
+ *	@brief Check BC computed on given graph against exact Brandes' BC computation
+ */
+inline void requireExactBC(
+	fastbc::brandes::IBrandesBC<int, float>& brandesBC,
+	std::shared_ptr<const fastbc::IGraph<int, float>> graph)
+{
+	std::vector<float> expectedBC = fastbc::brandes::ExactBrandesBC<int, float>().computeBC(graph);
+	std::vector<float> graphBC = brandesBC.computeBC(graph);
+
+	REQUIRE(graphBC.size() == expectedBC.size());
+	for (size_t i = 0; i < graphBC.size(); ++i)
+	{
+		REQUIRE(graphBC[i] == Approx(expectedBC[i]));
+	}
+}
+
+inline ScaledTestGraph::ScaledTestGraph()
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	_dwg = std::make_shared<fastbc::CSRGraph<int, float>>(dwgText);
+
+	// Scale of test graph edge weights: integral, fractional or unit weights
+	_scale = GENERATE(1.0f, 0.5f, 0.0f);
+}
+
+inline const fastbc::CSRGraph<int, float>& ScaledTestGraph::dwg() const
+{
+	return *_dwg;
+}
+
+inline void ScaledTestGraph::addEdge(int u, int v, float w)
+{
+	_src.push_back(u);
+	_dest.push_back(v);
+	_weight.push_back(_scale > 0 ? w * _scale : 1.0f);
+}
+
+inline void ScaledTestGraph::addDWGEdges(bool symmetric)
+{
+	for (int v : _dwg->vertices())
+	{
+		const auto fs = _dwg->forwardStar(v);
+		for (size_t i = 0; i < fs.size(); ++i)
+		{
+			addEdge(v, fs.vertex(i), fs.weight(i));
+			if (symmetric)
+			{
+				addEdge(fs.vertex(i), v, fs.weight(i));
+			}
+		}
+	}
+}
+
+inline std::shared_ptr<fastbc::IGraph<int, float>> ScaledTestGraph::build()
+{
+	return std::make_shared<fastbc::CSRGraph<int, float>>(
+		std::vector<int>(_src), std::vector<int>(_dest), std::vector<float>(_weight));
+}
+
+#endif
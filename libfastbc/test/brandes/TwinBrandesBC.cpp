@@ -0,0 +1,47 @@
+#include <catch2/catch.hpp>
+
+#include "ScaledTestGraph.h"
+
+#include <brandes/TwinBrandesBC.h>
+
+#include <utility>
+
+using namespace fastbc::brandes;
+
+TEST_CASE("Twin merged Brandes' BC computation test", "[brandes]")
+{
+	ScaledTestGraph testGraph;
+	testGraph.addDWGEdges();
+
+	// Twins of test graph vertices, with the same stars
+	const auto& dwg = testGraph.dwg();
+	int next = dwg.vertices().size();
+	for (const auto& [v, twins] : { std::make_pair(1, 1), std::make_pair(4, 2) })
+	{
+		for (int t = 0; t < twins; ++t, ++next)
+		{
+			const auto fs = dwg.forwardStar(v);
+			for (size_t i = 0; i < fs.size(); ++i)
+			{
+				testGraph.addEdge(next, fs.vertex(i), fs.weight(i));
+			}
+
+			const auto bs = dwg.backwardStar(v);
+			for (size_t i = 0; i < bs.size(); ++i)
+			{
+				testGraph.addEdge(bs.vertex(i), next, bs.weight(i));
+			}
+		}
+	}
+
+	// Twin pendant vertices
+	for (int t = 0; t < 3; ++t, ++next)
+	{
+		testGraph.addEdge(6, next, 2.0f);
+		testGraph.addEdge(next, 6, 2.0f);
+	}
+
+	TwinBrandesBC<int, float> twinBrandesBC;
+
+	requireExactBC(twinBrandesBC, testGraph.build());
+}
@@ -0,0 +1,133 @@
+#include <catch2/catch.hpp>
+
+#include <brandes/VertexInfoMatrix.h>
+
+#include <cstdint>
+
+using namespace fastbc::brandes;
+
+TEST_CASE("Vertex info matrix constructor", "[brandes]")
+{
+	VertexInfoMatrix<int, float> vim(5, 3);
+
+	REQUIRE(vim.rows() == 5);
+	REQUIRE(vim.borders() == 3);
+
+	// Rows are aligned to cache lines and zero initialized
+	for (size_t row = 0; row < vim.rows(); ++row)
+	{
+		REQUIRE((uintptr_t)vim.lengths(row) % VertexInfoMatrix<int, float>::alignment == 0);
+		REQUIRE((uintptr_t)vim.counts(row) % VertexInfoMatrix<int, float>::alignment == 0);
+
+		for (int b = 0; b < vim.borders(); ++b)
+		{
+			REQUIRE(vim.lengths(row)[b] == 0.0f);
+			REQUIRE(vim.counts(row)[b] == 0);
+		}
+	}
+
+	SECTION("Rows do not overlap")
+	{
+		vim.lengths(1)[2] = 5.7f;
+		vim.counts(1)[2] = 7;
+
+		REQUIRE(vim.lengths(2)[0] == 0.0f);
+		REQUIRE(vim.counts(2)[0] == 0);
+		REQUIRE(vim.lengths(1)[2] == 5.7f);
+		REQUIRE(vim.counts(1)[2] == 7);
+	}
+
+	SECTION("Copy keeps values")
+	{
+		vim.lengths(4)[1] = 2.5f;
+
+		VertexInfoMatrix<int, float> vimCopy = vim;
+		vimCopy.lengths(4)[1] = 3.5f;
+
+		REQUIRE(vim.lengths(4)[1] == 2.5f);
+		REQUIRE(vimCopy.lengths(4)[1] == 3.5f);
+		REQUIRE((uintptr_t)vimCopy.lengths(4) % VertexInfoMatrix<int, float>::alignment == 0);
+	}
+}
+
+TEST_CASE("Vertex info matrix row operations", "[brandes]")
+{
+	VertexInfoMatrix<int, float> vim(3, 2);
+
+	vim.lengths(0)[0] = 3.0f;
+	vim.lengths(0)[1] = 5.0f;
+	vim.counts(0)[0] = 1;
+	vim.counts(0)[1] = 2;
+
+	vim.lengths(1)[0] = 1.0f;
+	vim.lengths(1)[1] = 3.0f;
+	vim.counts(1)[0] = 1;
+	vim.counts(1)[1] = 2;
+
+	vim.lengths(2)[0] = 1.0f;
+	vim.lengths(2)[1] = 3.0f;
+	vim.counts(2)[0] = 4;
+	vim.counts(2)[1] = 2;
+
+	SECTION("Normalize and compare")
+	{
+		REQUIRE(vim.getMinBorderSPLength(0) == 3.0f);
+		REQUIRE(vim.compare(0, 1) != 0);
+
+		vim.normalize(0);
+		vim.normalize(1);
+
+		REQUIRE(vim.lengths(0)[0] == 0.0f);
+		REQUIRE(vim.lengths(0)[1] == 2.0f);
+		REQUIRE(vim.compare(0, 1) == 0);
+
+		// Counts are compared first
+		REQUIRE(vim.compare(1, 2) == -3.0f);
+	}
+
+	SECTION("Hash")
+	{
+		vim.normalize(0);
+		vim.normalize(1);
+
+		REQUIRE(vim.hash(0) == vim.hash(1));
+		REQUIRE(vim.hash(1) != vim.hash(2));
+	}
+
+	SECTION("Quantize")
+	{
+		vim.lengths(0)[1] = 5.3f;
+		vim.quantize(0, 0.5f);
+
+		REQUIRE(vim.lengths(0)[0] == 3.0f);
+		REQUIRE(vim.lengths(0)[1] == 5.5f);
+		REQUIRE(vim.getMaxBorderSPLength(0) == 5.5f);
+		REQUIRE(vim.counts(0)[1] == 2);
+	}
+
+	SECTION("Squared distance")
+	{
+		REQUIRE(vim.squaredDistance(0, vim, 0) == 0.0f);
+		REQUIRE(vim.squaredDistance(0, vim, 1) == 8.0f);
+		REQUIRE(vim.squaredDistance(1, vim, 2) == 9.0f);
+	}
+
+	SECTION("Centroid accumulation")
+	{
+		VertexInfoMatrix<float, float> centroid(1, 2);
+		centroid.add(0, vim, 0);
+		centroid.add(0, vim, 2);
+		centroid.divide(0, 2);
+
+		REQUIRE(centroid.lengths(0)[0] == 2.0f);
+		REQUIRE(centroid.lengths(0)[1] == 4.0f);
+		REQUIRE(centroid.counts(0)[0] == 2.5f);
+		REQUIRE(centroid.counts(0)[1] == 2.0f);
+
+		REQUIRE(centroid.squaredDistance(0, vim, 1) == Approx(1.0f + 1.0f + 2.25f + 0.0f));
+
+		centroid.reset();
+		REQUIRE(centroid.lengths(0)[0] == 0.0f);
+		REQUIRE(centroid.counts(0)[0] == 0.0f);
+	}
+}
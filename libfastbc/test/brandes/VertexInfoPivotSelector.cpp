@@ -2,7 +2,7 @@
 
 #include <brandes/VertexInfoPivotSelector.h>
 
-#include <brandes/VertexInfo.h>
+#include <brandes/VertexInfoMatrix.h>
 #include <algorithm>
 #include <memory>
 #include <set>
@@ -14,45 +14,41 @@ using namespace fastbc::brandes;
 TEST_CASE("Pivot selection", "[brandes]")
 {
 	std::vector<double> globalBC = { 1,2,2,1.5,1,3 };
-	std::vector<std::shared_ptr<VertexInfo<int, double>>> verticesInfo(globalBC.size());
-	for (int i = 0; i < verticesInfo.size(); ++i)
-	{
-		verticesInfo[i] = std::make_shared<VertexInfo<int, double>>(3);
-	}
-	verticesInfo[0]->setBorderSPLength(0, 1.0f);
-	verticesInfo[0]->setBorderSPLength(1, 2.0f);
-	verticesInfo[0]->setBorderSPLength(2, 3.0f);
-	verticesInfo[0]->setBorderSPCount(0, 2);
-	verticesInfo[0]->setBorderSPCount(1, 1);
-	verticesInfo[0]->setBorderSPCount(2, 1);
-
-	verticesInfo[1]->setBorderSPLength(0, 2.0f);
-	verticesInfo[1]->setBorderSPLength(1, 1.0f);
-	verticesInfo[1]->setBorderSPLength(2, 3.0f);
-	verticesInfo[1]->setBorderSPCount(0, 2);
-	verticesInfo[1]->setBorderSPCount(1, 2);
-	verticesInfo[1]->setBorderSPCount(2, 1);
-
-	verticesInfo[2]->setBorderSPLength(0, 2.0f);
-	verticesInfo[2]->setBorderSPLength(1, 3.0f);
-	verticesInfo[2]->setBorderSPLength(2, 4.0f);
-	verticesInfo[2]->setBorderSPCount(0, 2);
-	verticesInfo[2]->setBorderSPCount(1, 1);
-	verticesInfo[2]->setBorderSPCount(2, 1);
-
-	verticesInfo[3]->setBorderSPLength(0, 4.0f);
-	verticesInfo[3]->setBorderSPLength(1, 3.0f);
-	verticesInfo[3]->setBorderSPLength(2, 5.0f);
-	verticesInfo[3]->setBorderSPCount(0, 2);
-	verticesInfo[3]->setBorderSPCount(1, 2);
-	verticesInfo[3]->setBorderSPCount(2, 1);
-
-	verticesInfo[4]->setBorderSPLength(0, 5.0f);
-	verticesInfo[4]->setBorderSPLength(1, 1.0f);
-	verticesInfo[4]->setBorderSPLength(2, 3.0f);
-	verticesInfo[4]->setBorderSPCount(0, 1);
-	verticesInfo[4]->setBorderSPCount(1, 1);
-	verticesInfo[4]->setBorderSPCount(2, 3);
+	VertexInfoMatrix<int, double> verticesInfo(5, 3);
+	verticesInfo.lengths(0)[0] = 1.0f;
+	verticesInfo.lengths(0)[1] = 2.0f;
+	verticesInfo.lengths(0)[2] = 3.0f;
+	verticesInfo.counts(0)[0] = 2;
+	verticesInfo.counts(0)[1] = 1;
+	verticesInfo.counts(0)[2] = 1;
+
+	verticesInfo.lengths(1)[0] = 2.0f;
+	verticesInfo.lengths(1)[1] = 1.0f;
+	verticesInfo.lengths(1)[2] = 3.0f;
+	verticesInfo.counts(1)[0] = 2;
+	verticesInfo.counts(1)[1] = 2;
+	verticesInfo.counts(1)[2] = 1;
+
+	verticesInfo.lengths(2)[0] = 2.0f;
+	verticesInfo.lengths(2)[1] = 3.0f;
+	verticesInfo.lengths(2)[2] = 4.0f;
+	verticesInfo.counts(2)[0] = 2;
+	verticesInfo.counts(2)[1] = 1;
+	verticesInfo.counts(2)[2] = 1;
+
+	verticesInfo.lengths(3)[0] = 4.0f;
+	verticesInfo.lengths(3)[1] = 3.0f;
+	verticesInfo.lengths(3)[2] = 5.0f;
+	verticesInfo.counts(3)[0] = 2;
+	verticesInfo.counts(3)[1] = 2;
+	verticesInfo.counts(3)[2] = 1;
+
+	verticesInfo.lengths(4)[0] = 5.0f;
+	verticesInfo.lengths(4)[1] = 1.0f;
+	verticesInfo.lengths(4)[2] = 3.0f;
+	verticesInfo.counts(4)[0] = 1;
+	verticesInfo.counts(4)[1] = 1;
+	verticesInfo.counts(4)[2] = 3;
 
 	std::vector<int> vertices = { 0,1,2,3,4 };
 	std::set<int> borders = {};
@@ -72,4 +68,120 @@ TEST_CASE("Pivot selection", "[brandes]")
 	REQUIRE(pivots.second[0] == 2);
 	REQUIRE(pivots.second[1] == 2);
 	REQUIRE(pivots.second[2] == 1);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Pivot selection on many classes", "[brandes]")
+{
+	// Vertex v belongs to class v % classCount, given by its counts in base 7 digits,
+	// with lengths shifted by a different amount for each vertex
+	const int vertexCount = 2000;
+	const int classCount = 150;
+
+	std::vector<double> globalBC(vertexCount);
+	std::vector<int> vertices(vertexCount);
+	VertexInfoMatrix<int, double> verticesInfo(vertexCount, 4);
+	for (int v = 0; v < vertexCount; ++v)
+	{
+		int c = v % classCount;
+
+		globalBC[v] = vertexCount - v;
+		vertices[v] = v;
+		for (int b = 0, digit = 1; b < 4; ++b, digit *= 7)
+		{
+			verticesInfo.lengths(v)[b] = (c >> b) % 5 + v / classCount;
+			verticesInfo.counts(v)[b] = c / digit % 7;
+		}
+	}
+
+	VertexInfoPivotSelector<int, double> ps;
+
+	std::pair<std::vector<int>, std::vector<int>> pivots =
+		ps.selectPivots(globalBC, verticesInfo, vertices, {});
+
+	REQUIRE(pivots.first.size() == classCount);
+
+	// Classes follow order of their first vertex, pivot is the last vertex of minimum BC
+	for (int c = 0; c < classCount; ++c)
+	{
+		REQUIRE(pivots.first[c] % classCount == c);
+		REQUIRE(pivots.first[c] + classCount >= vertexCount);
+		REQUIRE(pivots.second[c] == (vertexCount - c + classCount - 1) / classCount);
+	}
+}
+
+
+TEST_CASE("Pivot selection with border distances tolerance", "[brandes]")
+{
+	// Vertices 0-2 have the same distances up to rounding errors, vertex 3 does not
+	std::vector<double> globalBC = { 3,1,2,1 };
+	std::vector<int> vertices = { 0,1,2,3 };
+	const std::vector<std::vector<double>> lengths = {
+		{ 0.1 + 0.2, 1.7, 2.9 },
+		{ 0.3, 1.7, 2.9 },
+		{ 0.3, 1.7000000001, 2.9 },
+		{ 0.3, 1.9, 2.9 } };
+
+	auto verticesInfo = [&]()
+	{
+		VertexInfoMatrix<int, double> vim(4, 3);
+		for (int v = 0; v < 4; ++v)
+		{
+			for (int b = 0; b < 3; ++b)
+			{
+				vim.lengths(v)[b] = lengths[v][b];
+				vim.counts(v)[b] = 1;
+			}
+		}
+		return vim;
+	};
+
+	SECTION("Exact distances")
+	{
+		VertexInfoMatrix<int, double> vim = verticesInfo();
+		VertexInfoPivotSelector<int, double> ps;
+
+		REQUIRE(ps.selectPivots(globalBC, vim, vertices, {}).first.size() == 4);
+		REQUIRE(ps.largestQuantum() == 0);
+	}
+
+	SECTION("Absolute tolerance")
+	{
+		VertexInfoMatrix<int, double> vim = verticesInfo();
+		VertexInfoPivotSelector<int, double> ps(1e-6);
+
+		auto pivots = ps.selectPivots(globalBC, vim, vertices, {});
+		REQUIRE(pivots.first == std::vector<int>({ 1, 3 }));
+		REQUIRE(pivots.second == std::vector<int>({ 3, 1 }));
+		REQUIRE(ps.largestQuantum() == 1e-6);
+	}
+
+	SECTION("Relative tolerance")
+	{
+		VertexInfoMatrix<int, double> vim = verticesInfo();
+		VertexInfoPivotSelector<int, double> ps(0, 1e-6);
+
+		auto pivots = ps.selectPivots(globalBC, vim, vertices, {});
+		REQUIRE(pivots.first == std::vector<int>({ 1, 3 }));
+		REQUIRE(pivots.second == std::vector<int>({ 3, 1 }));
+
+		// Largest quantum over clusters, the second one with longer distances
+		double firstQuantum = ps.largestQuantum();
+		REQUIRE(firstQuantum > 0);
+
+		VertexInfoMatrix<int, double> longer = verticesInfo();
+		for (int v = 0; v < 4; ++v)
+		{
+			longer.lengths(v)[2] = 100;
+		}
+		ps.selectPivots(globalBC, longer, vertices, {});
+		REQUIRE(ps.largestQuantum() > firstQuantum);
+
+		ps.selectPivots(globalBC, vim, vertices, {});
+		REQUIRE(ps.largestQuantum() > firstQuantum);
+	}
+
+	SECTION("Negative tolerance")
+	{
+		REQUIRE_THROWS(VertexInfoPivotSelector<int, double>(-1.0));
+	}
+}
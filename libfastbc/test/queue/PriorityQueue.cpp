@@ -0,0 +1,168 @@
+#include <catch2/catch.hpp>
+
+#include <queue/BucketQueue.h>
+#include <queue/DaryHeapQueue.h>
+#include <queue/PairingHeapQueue.h>
+#include <queue/RadixHeapQueue.h>
+#include <queue/SetQueue.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace fastbc::queue;
+
+TEMPLATE_TEST_CASE("Priority queue policies test", "[queue]",
+	(SetQueue<int, float>), (DaryHeapQueue<int, float>), (DaryHeapQueue<int, double, 2>),
+	(PairingHeapQueue<int, float>), (RadixHeapQueue<int, float>), (RadixHeapQueue<int, double>),
+	(RadixHeapQueue<int, int>), (BucketQueue<int, float>), (BucketQueue<int, int>))
+{
+	TestType queue;
+	queue.reserve(6);
+	REQUIRE(queue.empty());
+
+	queue.push(3, 5);
+	queue.push(1, 2);
+	queue.push(4, 7);
+	queue.push(0, 3);
+	queue.decrease(4, 1);
+
+	REQUIRE(queue.pop() == 4);
+	REQUIRE(queue.pop() == 1);
+
+	// Keys pushed after a pop are not lower than popped one
+	queue.push(5, 4);
+	queue.decrease(3, 4);
+
+	REQUIRE(queue.pop() == 0);
+
+	std::set<int> last = { queue.pop(), queue.pop() };
+	REQUIRE(last == std::set<int>({ 3, 5 }));
+	REQUIRE(queue.empty());
+
+	// Queue can be reused once emptied
+	queue.push(2, 1);
+	REQUIRE_FALSE(queue.empty());
+	REQUIRE(queue.pop() == 2);
+	REQUIRE(queue.empty());
+}
+
+TEMPLATE_TEST_CASE("Priority queue policies simulated Dijkstra test", "[queue]",
+	(DaryHeapQueue<int, double>), (PairingHeapQueue<int, double>), (RadixHeapQueue<int, double>))
+{
+	const int vertexCount = 1000;
+	std::mt19937 rng(42);
+	std::uniform_real_distribution<double> weight(0.1, 10.0);
+	std::uniform_int_distribution<int> vertex(0, vertexCount - 1);
+
+	SetQueue<int, double> reference;
+	TestType queue;
+	reference.reserve(vertexCount);
+	queue.reserve(vertexCount);
+
+	std::vector<double> key(vertexCount, -1);
+	std::vector<bool> popped(vertexCount, false);
+	double current = 0;
+
+	reference.push(0, 0);
+	queue.push(0, 0);
+	key[0] = 0;
+
+	while (!reference.empty())
+	{
+		int v = reference.pop();
+		int w = queue.pop();
+
+		// Random keys have no ties, so popped vertices must match
+		REQUIRE(w == v);
+		popped[v] = true;
+		current = key[v];
+
+		for (int i = 0; i < 8; ++i)
+		{
+			int u = vertex(rng);
+			double k = current + weight(rng);
+
+			if (popped[u] || (key[u] >= 0 && key[u] <= k))
+			{
+				continue;
+			}
+
+			if (key[u] < 0)
+			{
+				reference.push(u, k);
+				queue.push(u, k);
+			}
+			else
+			{
+				reference.decrease(u, k);
+				queue.decrease(u, k);
+			}
+			key[u] = k;
+		}
+	}
+
+	REQUIRE(queue.empty());
+}
+
+TEMPLATE_TEST_CASE("Priority queue policies simulated Dijkstra test with integer keys", "[queue]",
+	(BucketQueue<int, int>), (BucketQueue<int, double>), (RadixHeapQueue<int, int>))
+{
+	const int vertexCount = 1000;
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<int> weight(1, 100);
+	std::uniform_int_distribution<int> vertex(0, vertexCount - 1);
+
+	TestType queue;
+	queue.reserve(vertexCount);
+
+	std::vector<int> key(vertexCount, -1);
+	std::vector<bool> popped(vertexCount, false);
+	std::vector<int> poppedKeys;
+	int current = 0;
+
+	queue.push(0, 0);
+	key[0] = 0;
+
+	while (!queue.empty())
+	{
+		int v = queue.pop();
+
+		// Integer keys have ties, so only popped keys order is checked
+		REQUIRE_FALSE(popped[v]);
+		REQUIRE(key[v] >= current);
+		popped[v] = true;
+		current = key[v];
+		poppedKeys.push_back(current);
+
+		for (int i = 0; i < 8; ++i)
+		{
+			int u = vertex(rng);
+			int k = current + weight(rng);
+
+			if (popped[u] || (key[u] >= 0 && key[u] <= k))
+			{
+				continue;
+			}
+
+			if (key[u] < 0)
+			{
+				queue.push(u, k);
+			}
+			else
+			{
+				queue.decrease(u, k);
+			}
+			key[u] = k;
+		}
+	}
+
+	// Each reached vertex is popped once with its final key
+	for (int v = 0; v < vertexCount; ++v)
+	{
+		REQUIRE(popped[v] == (key[v] >= 0));
+	}
+	REQUIRE(std::is_sorted(poppedKeys.begin(), poppedKeys.end()));
+}
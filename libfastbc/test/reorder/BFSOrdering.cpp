@@ -0,0 +1,51 @@
+#include <catch2/catch.hpp>
+
+#include <reorder/BFSOrdering.h>
+
+#include <CSRGraph.h>
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <numeric>
+
+using namespace fastbc::reorder;
+
+TEST_CASE("BFS vertices ordering test", "[reorder]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	std::shared_ptr<fastbc::IGraph<int, float>> graph =
+		std::make_shared<fastbc::CSRGraph<int, float>>(dwgText);
+
+	std::vector<int> expected(graph->vertices().size());
+	std::iota(expected.begin(), expected.end(), 0);
+
+	SECTION("Breadth first order")
+	{
+		std::vector<int> order = BFSOrdering<int, float>(false, false).computeOrder(graph);
+
+		// Visit starts from vertex 0, followed by its neighbors
+		REQUIRE(order.size() == expected.size());
+		REQUIRE(order[0] == 0);
+		REQUIRE(std::is_permutation(order.begin(), order.end(), expected.begin()));
+	}
+
+	SECTION("Reverse Cuthill-McKee order")
+	{
+		std::vector<int> order = BFSOrdering<int, float>().computeOrder(graph);
+
+		REQUIRE(order.size() == expected.size());
+		REQUIRE(std::is_permutation(order.begin(), order.end(), expected.begin()));
+
+		// Cuthill-McKee visit starts from a minimum degree vertex, placed last once reversed
+		size_t minDegree = graph->forwardStar(order.back()).size() + graph->backwardStar(order.back()).size();
+		for (const auto& v : graph->vertices())
+		{
+			REQUIRE(minDegree <= graph->forwardStar(v).size() + graph->backwardStar(v).size());
+		}
+	}
+}
@@ -0,0 +1,82 @@
+#include <catch2/catch.hpp>
+
+#include <reorder/CommunityOrdering.h>
+
+#include <CSRGraph.h>
+#include <fstream>
+#include <memory>
+
+using namespace fastbc::reorder;
+
+namespace {
+
+	// Splits vertices in two halves, counting partition requests
+	class HalvesPartition : public fastbc::IGraphPartition<int, float>
+	{
+	public:
+		std::vector<std::vector<int>> partitionGraph(std::shared_ptr<const fastbc::IDegreeGraph<int, float>> graph) override
+		{
+			++calls;
+
+			std::vector<std::vector<int>> communities(2);
+			for (const auto& v : graph->vertices())
+			{
+				communities[2 * (size_t)v < graph->vertices().size() ? 0 : 1].push_back(v);
+			}
+
+			return communities;
+		}
+
+		size_t calls = 0;
+	};
+
+}
+
+TEST_CASE("Community vertices ordering test", "[reorder]")
+{
+	std::ifstream dwgText("DWGtext.txt");
+	if (!dwgText.is_open())
+	{
+		throw std::runtime_error("Unable to read test graph file.");
+	}
+
+	std::shared_ptr<fastbc::CSRGraph<int, float>> graph =
+		std::make_shared<fastbc::CSRGraph<int, float>>(dwgText);
+
+	auto partition = std::make_shared<HalvesPartition>();
+	CommunityOrdering<int, float> ordering(partition);
+
+	std::vector<int> order = ordering.computeOrder(graph);
+	REQUIRE(order.size() == graph->vertices().size());
+	REQUIRE(partition->calls == 1);
+
+	SECTION("Communities are reused only for the renumbered graph")
+	{
+		// Same vertex count, but not the graph renumbered with the order
+		auto other = std::make_shared<fastbc::CSRGraph<int, float>>(*graph);
+		ordering.orderApplied(graph);
+		ordering.partitionGraph(other);
+		REQUIRE(partition->calls == 2);
+
+		// Renumbered graph gets communities made of contiguous index ranges, once
+		std::vector<std::vector<int>> communities = ordering.partitionGraph(graph);
+		REQUIRE(partition->calls == 2);
+		int next = 0;
+		for (const auto& community : communities)
+		{
+			for (const auto& v : community)
+			{
+				REQUIRE(v == next++);
+			}
+		}
+
+		ordering.partitionGraph(graph);
+		REQUIRE(partition->calls == 3);
+	}
+
+	SECTION("Communities are not reused without applying the order")
+	{
+		ordering.partitionGraph(graph);
+		REQUIRE(partition->calls == 2);
+	}
+}
@@ -5,15 +5,29 @@
 #define FASTBC_BRANDES_ENABLE_PIVOT_BORDER
 #define FASTBC_BRANDES_CLUSTERED_IGNORE_UNCONNECTED
 
-#include <DirectedWeightedGraph.h>
+#include <EdgeListLoader.h>
+#include <MappedCSRGraph.h>
+#include <brandes/BlockBrandesBC.h>
+#include <brandes/BorderClusterEvaluator.h>
+#include <brandes/ChainContractedBrandesBC.h>
 #include <brandes/ClusteredBrandesBC.h>
-#include <brandes/DijkstraClusterEvaluator.h>
 #include <brandes/DijkstraSSBrandesBC.h>
 #include <brandes/ExactBrandesBC.h>
 #include <brandes/KMeansPivotSelector.h>
+#include <brandes/PrunedBrandesBC.h>
+#include <brandes/ReorderedBrandesBC.h>
+#include <brandes/TwinBrandesBC.h>
 #include <brandes/VertexInfoPivotSelector.h>
 #include <kmeans/PlusPlusKMeans.h>
 #include <louvain/LouvainGraphPartition.h>
+#include <queue/BucketQueue.h>
+#include <queue/DaryHeapQueue.h>
+#include <queue/DefaultQueue.h>
+#include <queue/PairingHeapQueue.h>
+#include <queue/RadixHeapQueue.h>
+#include <queue/SetQueue.h>
+#include <reorder/BFSOrdering.h>
+#include <reorder/CommunityOrdering.h>
 
 #include <chrono>
 #include <fstream>
@@ -30,6 +44,10 @@
 #define FASTBC_W_TYPE double
 #endif // !FASTBC_W_TYPE
 
+#ifndef FASTBC_QUEUE_TYPE
+#define FASTBC_QUEUE_TYPE fastbc::queue::DefaultQueue
+#endif // !FASTBC_QUEUE_TYPE
+
 #ifndef SPDLOG_ACTIVE_LEVEL
 #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_DEBUG
 #endif
@@ -42,12 +60,12 @@ int main(int argc, char **argv)
 	/*
 	 *	Program options 
 	 */
-	std::string edgeListPath, outBCPath, louvainSeed, loggerLevel;
+	std::string edgeListPath, outBCPath, binaryGraphPath, louvainSeed, reorderMode, loggerLevel;
 	int threads, louvainExecutors;
-	double louvainPrecision, kFrac;
-	bool exactBC;
+	double louvainPrecision, kFrac, classEpsilon, classRelativeEpsilon;
+	bool exactBC, deltaSteppingBC, pruneBC, contractBC, blocksBC, twinsBC, bordersOnly;
 
-	popl::OptionParser op("Usage: fastbc [ options ] <edge_list_path>");
+	popl::OptionParser op("Usage: fastbc [ options ] <edge_list_path|binary_graph_path>");
 	auto ls = op.add<popl::Value<std::string>, popl::Attribute::optional>(
 		"s", "louvain-seeds",
 		"Seeds to be used by each parallel louvain execution",
@@ -67,19 +85,62 @@ int main(int argc, char **argv)
 		"k", "kfrac",
 		"Topological classes aggregation factor (0-1). Enables 2-Clustered Brandes algorithm");
 	kf->assign_to(&kFrac);
+	op.add<popl::Value<double>, popl::Attribute::optional>(
+		"", "class-epsilon",
+		"Absolute tolerance of border distances grouping vertices in topological classes",
+		0.0,
+		&classEpsilon);
+	op.add<popl::Value<double>, popl::Attribute::optional>(
+		"", "class-relative-epsilon",
+		"Tolerance of border distances grouping vertices in topological classes, relative to cluster largest distance",
+		0.0,
+		&classRelativeEpsilon);
+	op.add<popl::Switch, popl::Attribute::optional>(
+		"", "borders-only",
+		"Compute clusters vertices information from border vertices only, skipping intra cluster BC correction",
+		&bordersOnly);
 	op.add<popl::Switch, popl::Attribute::optional>(
 		"", "exact",
 		"Force exact betweenness computation (very long time)",
 		&exactBC);
+	op.add<popl::Switch, popl::Attribute::optional>(
+		"", "delta-stepping",
+		"Compute exact betweenness one source at a time, in parallel within each source by delta-stepping",
+		&deltaSteppingBC);
+	op.add<popl::Switch, popl::Attribute::optional>(
+		"", "prune",
+		"Remove tree fringe vertices before exact computation, reconstructing their BC",
+		&pruneBC);
+	op.add<popl::Switch, popl::Attribute::optional>(
+		"", "contract",
+		"Contract chains of degree 2 vertices before exact computation, reconstructing their BC",
+		&contractBC);
+	op.add<popl::Switch, popl::Attribute::optional>(
+		"", "blocks",
+		"Split graph in biconnected blocks before exact computation, computing each block independently",
+		&blocksBC);
+	op.add<popl::Switch, popl::Attribute::optional>(
+		"", "twins",
+		"Merge vertices with the same neighbours before exact computation, sharing their BC",
+		&twinsBC);
 	auto nt = op.add<popl::Value<int>, popl::Attribute::optional>(
 		"t", "threads",
 		"Maximum number of threads used in parallel computation");
 	nt->assign_to(&threads);
+	op.add<popl::Value<std::string>, popl::Attribute::optional>(
+		"r", "reorder",
+		"Vertices reordering applied before computation (none|bfs|rcm|community)",
+		"none",
+		&reorderMode);
 	op.add<popl::Value<std::string>, popl::Attribute::optional>(
 		"o", "output",
 		"Output file path",
 		"bc.txt",
 		&outBCPath);
+	auto cv = op.add<popl::Value<std::string>, popl::Attribute::optional>(
+		"c", "convert",
+		"Convert input edge list to a binary graph file at given path and exit");
+	cv->assign_to(&binaryGraphPath);
 	op.add<popl::Value<std::string>, popl::Attribute::optional>(
 		"d", "debug",
 		"Logger level (trace|debug|info|warning|error|critical|off)",
@@ -120,6 +181,31 @@ int main(int argc, char **argv)
 	}
 	spdlog::set_level(log_level);
 
+	// Convert input edge list to binary graph and exit
+	if (cv->is_set())
+	{
+		if (std::ifstream(binaryGraphPath).good())
+		{
+			SPDLOG_CRITICAL("File \"{}\" already existing", binaryGraphPath);
+			return -2;
+		}
+
+		try {
+			auto textGraph = fastbc::EdgeListLoader<FASTBC_V_TYPE, FASTBC_W_TYPE>().load(edgeListPath);
+			fastbc::MappedCSRGraph<FASTBC_V_TYPE, FASTBC_W_TYPE>::save(*textGraph, binaryGraphPath);
+
+			SPDLOG_INFO("Graph with {} vertices and {} edges written to \"{}\"", 
+				textGraph->vertices().size(), textGraph->edges(), binaryGraphPath);
+		}
+		catch (std::exception& e)
+		{
+			SPDLOG_CRITICAL("There was an error converting given edge list file: {}", e.what());
+			return -1;
+		}
+
+		return 0;
+	}
+
 	// Check bc output file
 	std::ifstream outFileTest(outBCPath, std::ifstream::in);
 	if (outFileTest.good())
@@ -180,6 +266,62 @@ int main(int argc, char **argv)
 		}
 	}
 
+	// Check topological classes tolerances
+	if (classEpsilon < 0.0 || classRelativeEpsilon < 0.0 || classRelativeEpsilon >= 1.0)
+	{
+		SPDLOG_CRITICAL("Class epsilon must be non negative, class relative epsilon in range 0-1.");
+		return -1;
+	}
+
+	// Check reorder mode value
+	if (reorderMode != "none" && reorderMode != "bfs" && reorderMode != "rcm" && reorderMode != "community")
+	{
+		SPDLOG_CRITICAL("Unknown reorder mode \"{}\".", reorderMode);
+		return -1;
+	}
+
+	if (bordersOnly && exactBC)
+	{
+		SPDLOG_WARN("Border vertices only evaluation applies to clustered computation only, ignored");
+	}
+
+	if (deltaSteppingBC && !exactBC)
+	{
+		SPDLOG_WARN("Delta-stepping applies to exact computation only, ignored");
+	}
+
+	if (pruneBC && !exactBC)
+	{
+		SPDLOG_WARN("Tree fringe pruning applies to exact computation only, ignored");
+	}
+
+	if (contractBC && !exactBC)
+	{
+		SPDLOG_WARN("Chain contraction applies to exact computation only, ignored");
+	}
+
+	if (blocksBC && !exactBC)
+	{
+		SPDLOG_WARN("Block decomposition applies to exact computation only, ignored");
+	}
+
+	if (twinsBC && !exactBC)
+	{
+		SPDLOG_WARN("Twin vertices merging applies to exact computation only, ignored");
+	}
+
+	if ((int)pruneBC + (int)contractBC + (int)blocksBC + (int)twinsBC > 1)
+	{
+		SPDLOG_CRITICAL("Tree fringe pruning, chain contraction, block decomposition and twin vertices merging cannot be combined.");
+		return -1;
+	}
+
+	if (deltaSteppingBC && (pruneBC || contractBC || blocksBC || twinsBC))
+	{
+		SPDLOG_CRITICAL("Delta-stepping cannot be combined with exact graph reductions.");
+		return -1;
+	}
+
 	if(nt->is_set())
 	{
 		SPDLOG_INFO("Maximum number of threads set to {}", threads);
@@ -196,40 +338,124 @@ int main(int argc, char **argv)
 	/*
 	 *	Program initialization
 	 */
-	// Open graph text file
-	std::ifstream graphTextFile(edgeListPath);
-	if (!graphTextFile.is_open())
+	// Initialize graph object mapping given binary graph or loading given edge list file
+	std::shared_ptr<fastbc::IGraph<FASTBC_V_TYPE, FASTBC_W_TYPE>> graph;
+	try {
+		if (fastbc::MappedCSRGraph<FASTBC_V_TYPE, FASTBC_W_TYPE>::isBinaryGraph(edgeListPath))
+		{
+			graph = std::make_shared<fastbc::MappedCSRGraph<FASTBC_V_TYPE, FASTBC_W_TYPE>>(edgeListPath);
+		}
+		else
+		{
+			graph = fastbc::EdgeListLoader<FASTBC_V_TYPE, FASTBC_W_TYPE>().load(edgeListPath);
+		}
+	}
+	catch (std::exception& e)
 	{
-		SPDLOG_CRITICAL("There was an error opening given edge list file path.");
+		SPDLOG_CRITICAL("There was an error loading given edge list file: {}", e.what());
 		return -1;
 	}
 
-	// Initialize graph object with loaded text file
-	std::shared_ptr<fastbc::IGraph<FASTBC_V_TYPE, FASTBC_W_TYPE>> graph =
-		std::make_shared<fastbc::DirectedWeightedGraph<FASTBC_V_TYPE, FASTBC_W_TYPE>>(graphTextFile);
-
 	// Print some information about loaded graph
 	SPDLOG_INFO("Loaded graph contains {} vertices and {} edges", graph->vertices().size(), graph->edges());
 
+	/* Vertices ordering */
+	std::shared_ptr<fastbc::reorder::IVertexOrdering<FASTBC_V_TYPE, FASTBC_W_TYPE>> ordering;
+	std::shared_ptr<fastbc::reorder::CommunityOrdering<FASTBC_V_TYPE, FASTBC_W_TYPE>> communityOrdering;
+	if (reorderMode == "bfs" || reorderMode == "rcm")
+	{
+		SPDLOG_INFO("Vertices ordering: {}", reorderMode);
+		ordering = std::make_shared<fastbc::reorder::BFSOrdering<FASTBC_V_TYPE, FASTBC_W_TYPE>>(
+			reorderMode == "rcm", reorderMode == "rcm");
+	}
+	else if (reorderMode == "community")
+	{
+		SPDLOG_INFO("Vertices ordering: community");
+		communityOrdering = std::make_shared<fastbc::reorder::CommunityOrdering<FASTBC_V_TYPE, FASTBC_W_TYPE>>(
+			std::make_shared<fastbc::louvain::LouvainGraphPartition<FASTBC_V_TYPE, FASTBC_W_TYPE>>(
+				seed, louvainPrecision));
+		ordering = communityOrdering;
+	}
+
 	std::shared_ptr<fastbc::brandes::IBrandesBC<FASTBC_V_TYPE, FASTBC_W_TYPE>> brandesBC;
+	std::shared_ptr<fastbc::brandes::VertexInfoPivotSelector<FASTBC_V_TYPE, FASTBC_W_TYPE>> vertexInfoSelector;
 	if(exactBC)
 	{
-		SPDLOG_INFO("Algorithm: exact Brandes' betweenness centrality");
-		brandesBC = 
-			std::make_shared<fastbc::brandes::ExactBrandesBC<FASTBC_V_TYPE, FASTBC_W_TYPE>>();
+		if (pruneBC)
+		{
+			SPDLOG_INFO("Algorithm: exact Brandes' betweenness centrality on tree fringe pruned graph");
+			brandesBC =
+				std::make_shared<fastbc::brandes::PrunedBrandesBC<FASTBC_V_TYPE, FASTBC_W_TYPE>>(
+					std::make_shared<fastbc::brandes::DijkstraSSBrandesBC<FASTBC_V_TYPE, FASTBC_W_TYPE,
+						FASTBC_QUEUE_TYPE<FASTBC_V_TYPE, FASTBC_W_TYPE>>>());
+		}
+		else if (blocksBC)
+		{
+			SPDLOG_INFO("Algorithm: exact Brandes' betweenness centrality on graph blocks");
+			brandesBC =
+				std::make_shared<fastbc::brandes::BlockBrandesBC<FASTBC_V_TYPE, FASTBC_W_TYPE>>(
+					std::make_shared<fastbc::brandes::DijkstraSSBrandesBC<FASTBC_V_TYPE, FASTBC_W_TYPE,
+						FASTBC_QUEUE_TYPE<FASTBC_V_TYPE, FASTBC_W_TYPE>>>());
+		}
+		else if (twinsBC)
+		{
+			SPDLOG_INFO("Algorithm: exact Brandes' betweenness centrality on twin merged graph");
+			brandesBC =
+				std::make_shared<fastbc::brandes::TwinBrandesBC<FASTBC_V_TYPE, FASTBC_W_TYPE,
+					FASTBC_QUEUE_TYPE<FASTBC_V_TYPE, FASTBC_W_TYPE>>>();
+		}
+		else if (contractBC)
+		{
+			SPDLOG_INFO("Algorithm: exact Brandes' betweenness centrality on chain contracted graph");
+			brandesBC =
+				std::make_shared<fastbc::brandes::ChainContractedBrandesBC<FASTBC_V_TYPE, FASTBC_W_TYPE,
+					FASTBC_QUEUE_TYPE<FASTBC_V_TYPE, FASTBC_W_TYPE>>>();
+		}
+		else
+		{
+			SPDLOG_INFO("Algorithm: exact Brandes' betweenness centrality");
+			brandesBC = 
+				std::make_shared<fastbc::brandes::ExactBrandesBC<FASTBC_V_TYPE, FASTBC_W_TYPE,
+					FASTBC_QUEUE_TYPE<FASTBC_V_TYPE, FASTBC_W_TYPE>>>(deltaSteppingBC);
+		}
 	}
 	else
 	{
 		/* Louvain community detector */
-		std::shared_ptr<fastbc::IGraphPartition<FASTBC_V_TYPE, FASTBC_W_TYPE>> louvainEvaluator =
-			std::make_shared<fastbc::louvain::LouvainGraphPartition<FASTBC_V_TYPE, FASTBC_W_TYPE>>(
-				seed, louvainPrecision);
+		/* Communities computed by community ordering are reused on the reordered graph */
+		std::shared_ptr<fastbc::IGraphPartition<FASTBC_V_TYPE, FASTBC_W_TYPE>> louvainEvaluator;
+		if (communityOrdering)
+		{
+			louvainEvaluator = communityOrdering;
+		}
+		else
+		{
+			louvainEvaluator =
+				std::make_shared<fastbc::louvain::LouvainGraphPartition<FASTBC_V_TYPE, FASTBC_W_TYPE>>(
+					seed, louvainPrecision);
+		}
 
 		/* Brandes cluster evaluator */
-		std::shared_ptr<fastbc::brandes::IClusterEvaluator<FASTBC_V_TYPE, FASTBC_W_TYPE>> clusterEvaluator =
-			std::make_shared<fastbc::brandes::DijkstraClusterEvaluator<FASTBC_V_TYPE, FASTBC_W_TYPE>>();
+		/* Without borders only evaluation it is selected from graph edge weights */
+		std::shared_ptr<fastbc::brandes::IClusterEvaluator<FASTBC_V_TYPE, FASTBC_W_TYPE>> clusterEvaluator;
+		if (bordersOnly)
+		{
+			SPDLOG_INFO("Evaluating clusters from border vertices only, without intra cluster BC");
+			clusterEvaluator =
+				std::make_shared<fastbc::brandes::BorderClusterEvaluator<FASTBC_V_TYPE, FASTBC_W_TYPE,
+					FASTBC_QUEUE_TYPE<FASTBC_V_TYPE, FASTBC_W_TYPE>>>();
+		}
 
 		/* Cluster pivot selector */
+		/* Topological classes group vertices with border distances equal up to given tolerances */
+		if (classEpsilon > 0.0 || classRelativeEpsilon > 0.0)
+		{
+			SPDLOG_INFO("Topological classes border distances tolerance: absolute {}, relative {}",
+				classEpsilon, classRelativeEpsilon);
+		}
+		vertexInfoSelector =
+			std::make_shared<fastbc::brandes::VertexInfoPivotSelector<FASTBC_V_TYPE, FASTBC_W_TYPE>>(
+				classEpsilon, classRelativeEpsilon);
 		std::shared_ptr<fastbc::brandes::IPivotSelector<FASTBC_V_TYPE, FASTBC_W_TYPE>> pivotSelector;
 		if (kf->is_set())
 		{
@@ -237,8 +463,7 @@ int main(int argc, char **argv)
 			// Kmeans approximated pivot selector
 			pivotSelector = 
 				std::make_shared<fastbc::brandes::KMeansPivotSelector<FASTBC_V_TYPE, FASTBC_W_TYPE>>(
-					std::shared_ptr<fastbc::brandes::IPivotSelector<FASTBC_V_TYPE, FASTBC_W_TYPE>>(
-						new fastbc::brandes::VertexInfoPivotSelector<FASTBC_V_TYPE, FASTBC_W_TYPE>()),
+					vertexInfoSelector,
 					std::shared_ptr<fastbc::kmeans::IKMeans<FASTBC_V_TYPE, FASTBC_W_TYPE>>(
 						new fastbc::kmeans::PlusPlusKMeans<FASTBC_V_TYPE, FASTBC_W_TYPE>()),
 					kFrac);
@@ -246,18 +471,22 @@ int main(int argc, char **argv)
 		else
 		{
 			SPDLOG_INFO("Algorithm: clustered Brandes' betweenness centrality");
-			pivotSelector = 
-				std::make_shared<fastbc::brandes::VertexInfoPivotSelector<FASTBC_V_TYPE, FASTBC_W_TYPE>>();
+			pivotSelector = vertexInfoSelector;
 		}
 
-		/* Single source Brandes */
-		std::shared_ptr<fastbc::brandes::DijkstraSSBrandesBC<FASTBC_V_TYPE, FASTBC_W_TYPE>> singleSourceBC =
-			std::make_shared<fastbc::brandes::DijkstraSSBrandesBC<FASTBC_V_TYPE, FASTBC_W_TYPE>>();
-
 		/* Clustered Brandes Betweenness centrality calculator */
+		/* Single source Brandes is selected from graph edge weights */
+		brandesBC =
+			std::make_shared<fastbc::brandes::ClusteredBrandeBC<FASTBC_V_TYPE, FASTBC_W_TYPE,
+				FASTBC_QUEUE_TYPE<FASTBC_V_TYPE, FASTBC_W_TYPE>>>(
+				louvainEvaluator, clusterEvaluator, nullptr, pivotSelector);
+	}
+
+	if (ordering)
+	{
 		brandesBC =
-			std::make_shared<fastbc::brandes::ClusteredBrandeBC<FASTBC_V_TYPE, FASTBC_W_TYPE>>(
-				louvainEvaluator, clusterEvaluator, singleSourceBC, pivotSelector);
+			std::make_shared<fastbc::brandes::ReorderedBrandesBC<FASTBC_V_TYPE, FASTBC_W_TYPE>>(
+				ordering, brandesBC);
 	}
 	
 
@@ -276,6 +505,13 @@ int main(int argc, char **argv)
 
 	SPDLOG_INFO("Total computation time: {}.{}ms", milliTime, microTime);
 
+	// Effective error bound of topological classes, over all clusters
+	if (vertexInfoSelector && (classEpsilon > 0.0 || classRelativeEpsilon > 0.0))
+	{
+		SPDLOG_INFO("Normalized border SP lengths in a topological class differ by at most {}",
+			vertexInfoSelector->largestQuantum());
+	}
+
 	/*
 	 *	Save results
 	 */